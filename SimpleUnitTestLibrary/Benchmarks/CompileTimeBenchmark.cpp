@@ -0,0 +1,254 @@
+// Measures how long a large synthetic test tree (many test files and one runner) takes to build against the headers
+// (SUTL target) and against the modules (SUTL_BUILD_MODULES), i.e., how much of each test file's compile goes to
+// parsing the library and the standard headers it pulls in.
+//
+//   CompileTimeBenchmark <work directory> [test files] [tests per file] [repetitions] [generator]
+//
+// Both trees are configured once (untimed), then fully rebuilt (--clean-first) repetitions times; the best build is
+// reported, and each tree's tests are run once to check that it works. Needs cmake on the PATH, and a generator with
+// module support (Ninja by default).
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <print>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "APIAnnotations.h"
+
+#if !defined(SUTL_SOURCE_DIR)
+#error SUTL_SOURCE_DIR must name the SimpleUnitTestLibrary source directory (the one with the top-level CMakeLists.txt).
+#endif
+
+
+namespace
+{
+    struct TreeShape
+    {
+        std::uint32_t m_TestFileCount{800};
+        std::uint32_t m_TestsPerFile{10};
+    };
+
+    void WriteFile(
+        _In_ const std::filesystem::path& filePath,
+        _In_ const std::string_view contentSV)
+    {
+        std::ofstream file{filePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+        file.write(contentSV.data(), static_cast<std::streamsize>(contentSV.size()));
+        if (!file)
+        {
+            throw std::runtime_error{std::format("Failed to write {}", filePath.string())};
+        }
+    }
+
+    // The same sources build both ways: the modules target defines SUTL_USE_MODULES for its importers.
+    constexpr std::string_view g_cLibraryPreambleSV
+    {
+        "#if defined(SUTL_USE_MODULES)\n"
+        "#include <source_location>\n"
+        "#include <string>\n"
+        "#include <string_view>\n"
+        "#include <vector>\n"
+        "import SimpleUnitTestLibrary;\n"
+        "#else\n"
+        "#include \"SimpleUnitTestLibrary.h\"\n"
+        "#endif\n"
+        "#include \"SimpleUnitTestLibrary.Macros.h\"\n"
+        "\n"
+    };
+
+    // Each test file is one static suite of small, pure-logic tests, like most real test files.
+    [[nodiscard]] std::string GenerateTestFile(
+        _In_ const std::uint32_t fileIndex,
+        _In_ const std::uint32_t testCount)
+    {
+        std::string source{g_cLibraryPreambleSV};
+        for (std::uint32_t i = 0; i < testCount; ++i)
+        {
+            std::format_to(std::back_inserter(source),
+                "static SUTL::Result Test_{0}_{1}()\n"
+                "{{\n"
+                "    const std::string name{{\"Test_{0}_{1}\"}};\n"
+                "    SUTL_TEST_ASSERT(name.size() == std::string_view{{\"Test_{0}_{1}\"}}.size());\n"
+                "    SUTL_TEST_ASSERT(({0}u * {1}u) + {1}u == ({0}u + 1u) * {1}u);\n"
+                "    SUTL_TEST_SUCCESS();\n"
+                "}}\n"
+                "\n",
+                fileIndex, i);
+        }
+
+        std::format_to(std::back_inserter(source), "constexpr SUTL::StaticTestDescriptor g_cTests_{}[]\n{{\n", fileIndex);
+        for (std::uint32_t i = 0; i < testCount; ++i)
+        {
+            std::format_to(std::back_inserter(source), "    SUTL_STATIC_UNIT_TEST(Test_{}_{}),\n", fileIndex, i);
+        }
+
+        std::format_to(std::back_inserter(source),
+            "}};\n"
+            "\n"
+            "SUTL_REGISTER_STATIC_SUITE(g_cSuite_{0}, \"Suite_{0}\", g_cTests_{0});\n",
+            fileIndex);
+        return source;
+    }
+
+    void GenerateTree(
+        _In_ const std::filesystem::path& treeDirectory,
+        _In_ const TreeShape& treeShape)
+    {
+        std::filesystem::create_directories(treeDirectory);
+
+        std::string sourceList;
+        for (std::uint32_t i = 0; i < treeShape.m_TestFileCount; ++i)
+        {
+            const std::string fileName{std::format("Test_{}.cpp", i)};
+            WriteFile(treeDirectory / fileName, GenerateTestFile(i, treeShape.m_TestsPerFile));
+            std::format_to(std::back_inserter(sourceList), "    {}\n", fileName);
+        }
+
+        WriteFile(treeDirectory / "Main.cpp", std::string{g_cLibraryPreambleSV} +
+            "int main(const int argc, const char* argv[])\n"
+            "{\n"
+            "    const SUTL::Runner runner{SUTL::Runner::FromCommandLine(argc, argv)};\n"
+            "    for (const auto& suiteResult : runner())\n"
+            "    {\n"
+            "        if (!suiteResult)\n"
+            "        {\n"
+            "            return 1;\n"
+            "        }\n"
+            "    }\n"
+            "\n"
+            "    return 0;\n"
+            "}\n");
+
+        WriteFile(treeDirectory / "CMakeLists.txt", std::format(
+            "cmake_minimum_required(VERSION 3.28)\n"
+            "project(SutlCompileTimeBenchmarkTree LANGUAGES CXX)\n"
+            "\n"
+            "add_subdirectory(\"{}\" sutl)\n"
+            "\n"
+            "add_executable(sutl-benchmark-tree\n"
+            "    Main.cpp\n"
+            "{}"
+            ")\n"
+            "set_target_properties(sutl-benchmark-tree PROPERTIES\n"
+            "    CXX_STANDARD 23\n"
+            "    CXX_STANDARD_REQUIRED ON\n"
+            "    CXX_EXTENSIONS OFF\n"
+            ")\n"
+            "\n"
+            "if(SUTL_BUILD_MODULES)\n"
+            "    target_link_libraries(sutl-benchmark-tree PRIVATE SUTLModules)\n"
+            "    set_target_properties(sutl-benchmark-tree PROPERTIES CXX_SCAN_FOR_MODULES ON)\n"
+            "else()\n"
+            "    target_link_libraries(sutl-benchmark-tree PRIVATE SUTL)\n"
+            "endif()\n",
+            std::filesystem::path{SUTL_SOURCE_DIR}.generic_string(), sourceList));
+    }
+
+    [[nodiscard]] int RunCommand(_In_ const std::string& command)
+    {
+        std::println("> {}", command);
+        return std::system(command.c_str());
+    }
+
+    struct BuildMeasurement
+    {
+        bool m_bSucceeded{false};
+        double m_BestSeconds{0.0};
+    };
+
+    [[nodiscard]] BuildMeasurement MeasureBuild(
+        _In_ const std::filesystem::path& treeDirectory,
+        _In_ const std::filesystem::path& buildDirectory,
+        _In_ const std::string_view generatorSV,
+        _In_ const bool bModules,
+        _In_ const int repetitions)
+    {
+        BuildMeasurement measurement;
+        if (RunCommand(std::format("cmake -S \"{}\" -B \"{}\" -G \"{}\" -DCMAKE_BUILD_TYPE=Release -DSUTL_BUILD_MODULES={}",
+            treeDirectory.string(), buildDirectory.string(), generatorSV, bModules ? "ON" : "OFF")) != 0)
+        {
+            return measurement;
+        }
+
+        const std::string buildCommand{std::format("cmake --build \"{}\" --clean-first --parallel {}",
+            buildDirectory.string(), std::max(std::thread::hardware_concurrency(), 1u))};
+        for (int i = 0; i < repetitions; ++i)
+        {
+            const auto begin{std::chrono::steady_clock::now()};
+            if (RunCommand(buildCommand) != 0)
+            {
+                return measurement;
+            }
+
+            const double seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count()};
+            if ((i == 0) || (seconds < measurement.m_BestSeconds))
+            {
+                measurement.m_BestSeconds = seconds;
+            }
+        }
+
+        measurement.m_bSucceeded = RunCommand(std::format("\"{}\"", (buildDirectory / "sutl-benchmark-tree").string())) == 0;
+        return measurement;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::println(stderr, "Usage: {} <work directory> [test files] [tests per file] [repetitions] [generator]", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::filesystem::path workDirectory{argv[1]};
+    TreeShape treeShape;
+    if (argc > 2)
+    {
+        treeShape.m_TestFileCount = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[2])));
+    }
+
+    if (argc > 3)
+    {
+        treeShape.m_TestsPerFile = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[3])));
+    }
+
+    const int repetitions{(argc > 4) ? std::max(1, std::atoi(argv[4])) : 1};
+    const std::string_view generatorSV{(argc > 5) ? argv[5] : "Ninja"};
+
+    const std::filesystem::path treeDirectory{workDirectory / "tree"};
+    GenerateTree(treeDirectory, treeShape);
+
+    const BuildMeasurement headerMeasurement{MeasureBuild(treeDirectory, workDirectory / "build-headers", generatorSV, false, repetitions)};
+    const BuildMeasurement moduleMeasurement{MeasureBuild(treeDirectory, workDirectory / "build-modules", generatorSV, true, repetitions)};
+
+    std::println("");
+    std::println("{:>8} {:>10} {:>10} {:>12} {:>10}", "files", "build", "seconds", "ms/file", "speedup");
+    for (const auto& [buildSV, measurement] : {std::pair{"headers", headerMeasurement}, std::pair{"modules", moduleMeasurement}})
+    {
+        if (!measurement.m_bSucceeded)
+        {
+            std::println("{:>8} {:>10} {:>10}", treeShape.m_TestFileCount, buildSV, "failed");
+            continue;
+        }
+
+        const std::string speedup{headerMeasurement.m_bSucceeded
+            ? std::format("{:.2f}x", headerMeasurement.m_BestSeconds / measurement.m_BestSeconds)
+            : std::string{"n/a"}};
+        std::println("{:>8} {:>10} {:>10.2f} {:>12.1f} {:>10}",
+            treeShape.m_TestFileCount, buildSV, measurement.m_BestSeconds,
+            (measurement.m_BestSeconds * 1e3) / static_cast<double>(treeShape.m_TestFileCount), speedup);
+    }
+
+    return (headerMeasurement.m_bSucceeded && moduleMeasurement.m_bSucceeded) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,96 @@
+// Measures report generation (Suite::RunResults::ToString / FormatTo) for large suites.
+//
+//   ReportBenchmark [repetitions]
+//
+// Each suite has 1% failing tests (which get the multi-line failure details) and long-ish, varied test names.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iterator>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SimpleUnitTestLibrary.h"
+#include "SimpleUnitTestLibrary.Macros.h"
+
+
+namespace
+{
+    SUTL::Result PassingTest()
+    {
+        SUTL_TEST_SUCCESS();
+    }
+
+    SUTL::Result FailingTest()
+    {
+        constexpr bool bFlag{false};
+        SUTL_TEST_ASSERT(bFlag);
+        SUTL_TEST_SUCCESS();
+    }
+
+    [[nodiscard]] SUTL::Suite::RunResults MakeRunResults(_In_ const std::size_t testCount)
+    {
+        std::vector<SUTL::Test> tests;
+        tests.reserve(testCount);
+        for (std::size_t i = 0; i < testCount; ++i)
+        {
+            tests.emplace_back(std::format("ReportBenchmarkTest_{}_{}", (i % 7 == 0) ? "WithALongerName" : "Short", i), ((i % 100) == 99) ? FailingTest : PassingTest);
+            tests.back()();
+        }
+
+        return SUTL::Suite::RunResults{"ReportBenchmarkSuite", std::move(tests)};
+    }
+
+    template <typename FnT>
+    [[nodiscard]] double MeasureBestMs(
+        _In_ const int repetitions,
+        _Inout_ FnT&& fn)
+    {
+        double bestMs{0.0};
+        for (int i = 0; i < repetitions; ++i)
+        {
+            const auto begin{std::chrono::steady_clock::now()};
+            fn();
+            const double ms{std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count()};
+            bestMs = (i == 0) ? ms : std::min(bestMs, ms);
+        }
+
+        return bestMs;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int repetitions{(argc > 1) ? std::max(1, std::atoi(argv[1])) : 5};
+
+    std::println("{:>8} {:>12} {:>12} {:>14} {:>14}", "tests", "report KB", "ToString ms", "FormatTo ms", "ns/test");
+    for (const std::size_t testCount : {std::size_t{10'000}, std::size_t{100'000}})
+    {
+        const SUTL::Suite::RunResults runResults{MakeRunResults(testCount)};
+
+        std::size_t reportSize{0};
+        const double toStringMs{MeasureBestMs(repetitions, [&]
+        {
+            reportSize = runResults.ToString().size();
+        })};
+
+        // Into a caller-owned buffer that is reused across reports (e.g., one per suite).
+        std::string buffer;
+        const double formatToMs{MeasureBestMs(repetitions, [&]
+        {
+            buffer.clear();
+            runResults.FormatTo(std::back_inserter(buffer));
+        })};
+
+        std::println("{:>8} {:>12} {:>12.2f} {:>14.2f} {:>14.1f}",
+            testCount, reportSize / 1024, toStringMs, formatToMs, (toStringMs * 1e6) / static_cast<double>(testCount));
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+// Measures running (Suite::operator()) and summarizing (RunResults counts and report layout) suites of trivial tests,
+// i.e., the per-test overhead of Suite's own bookkeeping and data layout.
+//
+//   SuiteLayoutBenchmark [repetitions]
+//
+// A run is split in two phases, timed separately: Suite's own pass over its tests (selecting, running, and counting them,
+// which for passing tests only touches its hot arrays), and building the RunResults it returns. The benchmark suite's setup and cleanup bracket the first: setup runs right
+// before the first test, and cleanup right after the last one, before the results are built.
+// Cache misses per test are reported too where hardware counters are available (Linux perf_event_open).
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "SimpleUnitTestLibrary.h"
+#include "SimpleUnitTestLibrary.Macros.h"
+
+
+namespace
+{
+    struct Measurement
+    {
+        double m_BestMs{0.0};
+        SUTL::PerfCounterStats m_PerfCounterStats;
+
+        void Add(
+            _In_ const double ms,
+            _In_ const SUTL::PerfCounterStats& perfCounterStats,
+            _In_ const bool bFirst)
+        {
+            if (bFirst || (ms < m_BestMs))
+            {
+                m_BestMs = ms;
+                m_PerfCounterStats = perfCounterStats;
+            }
+        }
+    };
+
+    // One phase of a measurement in flight. Counters are enabled only around the scope's construction, so tests don't
+    // each measure their own.
+    class PhaseTimer
+    {
+    private:
+
+        std::optional<SUTL::PerfCounterScope> m_PerfCounterScope;
+        std::chrono::steady_clock::time_point m_Begin;
+
+    public:
+
+        void Begin()
+        {
+            SUTL::Internal_::g_bPerfCountersEnabled.store(true, std::memory_order_relaxed);
+            m_PerfCounterScope.emplace();
+            SUTL::Internal_::g_bPerfCountersEnabled.store(false, std::memory_order_relaxed);
+            m_Begin = std::chrono::steady_clock::now();
+        }
+
+        void End(
+            _Inout_ Measurement& measurement,
+            _In_ const bool bFirst)
+        {
+            const double ms{std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Begin).count()};
+            measurement.Add(ms, m_PerfCounterScope->GetStats(), bFirst);
+            m_PerfCounterScope.reset();
+        }
+    };
+
+    // The suite's setup and cleanup are plain functions, so the phase state they mark is global.
+    PhaseTimer g_RunPassTimer;
+    PhaseTimer g_RunResultsTimer;
+    Measurement g_RunPassMeasurement;
+    bool g_bFirstRepetition{true};
+
+    SUTL::Result TrivialTest()
+    {
+        SUTL_TEST_SUCCESS();
+    }
+
+    SUTL::Result BeginRunPass()
+    {
+        g_RunPassTimer.Begin();
+        SUTL_TEST_SUCCESS();
+    }
+
+    SUTL::Result EndRunPass()
+    {
+        g_RunPassTimer.End(g_RunPassMeasurement, g_bFirstRepetition);
+        g_RunResultsTimer.Begin();
+        SUTL_TEST_SUCCESS();
+    }
+
+    void PrintMeasurement(
+        _In_ const std::string_view phaseSV,
+        _In_ const std::size_t testCount,
+        _In_ const Measurement& measurement)
+    {
+        const std::string cacheMisses{measurement.m_PerfCounterStats.IsAvailable(SUTL::PerfCounter::CacheMisses)
+            ? std::format("{:.2f}", static_cast<double>(measurement.m_PerfCounterStats.GetValue(SUTL::PerfCounter::CacheMisses)) / static_cast<double>(testCount))
+            : std::string{"n/a"}};
+
+        std::println("{:>8} {:>10} {:>10.2f} {:>10.1f} {:>16}",
+            testCount, phaseSV, measurement.m_BestMs, (measurement.m_BestMs * 1e6) / static_cast<double>(testCount), cacheMisses);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int repetitions{(argc > 1) ? std::max(1, std::atoi(argv[1])) : 5};
+
+    std::println("{:>8} {:>10} {:>10} {:>10} {:>16}", "tests", "phase", "ms", "ns/test", "cache misses/test");
+    for (const std::size_t testCount : {std::size_t{10'000}, std::size_t{100'000}})
+    {
+        std::vector<std::string> testNames(testCount);
+        for (std::size_t i = 0; i < testCount; ++i)
+        {
+            testNames[i] = std::format("SuiteLayoutBenchmarkTest_{}", i);
+        }
+
+        std::vector<SUTL::Test> tests;
+        tests.reserve(testCount);
+        for (const std::string& testName : testNames)
+        {
+            tests.emplace_back(testName, TrivialTest);
+        }
+
+        // A suite's tests only run once, so each repetition builds a fresh suite (untimed).
+        Measurement runResultsMeasurement;
+        std::unique_ptr<SUTL::Suite::RunResults> pRunResults;
+        for (int i = 0; i < repetitions; ++i)
+        {
+            g_bFirstRepetition = (i == 0);
+            pRunResults.reset();
+            const SUTL::Suite suite{"SuiteLayoutBenchmarkSuite", tests, BeginRunPass, EndRunPass};
+
+            auto runResults{suite()};
+            g_RunResultsTimer.End(runResultsMeasurement, g_bFirstRepetition);
+            pRunResults = std::make_unique<SUTL::Suite::RunResults>(std::move(runResults));
+        }
+
+        // Tests that passed with nothing to report are listed (their results rebuilt by the suite) like any other.
+        const auto passedTestCount{std::ranges::count_if(*pRunResults,
+            [](_In_ const SUTL::Test& test) { return test.GetResult().m_ResultType == SUTL::ResultType::Success; })};
+        if (static_cast<std::size_t>(passedTestCount) != (testCount + 2))
+        {
+            return EXIT_FAILURE;
+        }
+
+        PrintMeasurement("run", testCount, g_RunPassMeasurement);
+        PrintMeasurement("results", testCount, runResultsMeasurement);
+
+        std::uint64_t summary{0};
+        Measurement summarizeMeasurement;
+        for (int i = 0; i < repetitions; ++i)
+        {
+            PhaseTimer summarizeTimer;
+            summarizeTimer.Begin();
+            const SUTL::ResultTypeCounts& resultTypeCounts{pRunResults->GetResultTypeCounts()};
+            summary += std::accumulate(resultTypeCounts.cbegin(), resultTypeCounts.cend(), std::uint64_t{0});
+            summary += pRunResults->GetReportLayout().m_MaxTestNameLength;
+            summary += !!*pRunResults;
+            summarizeTimer.End(summarizeMeasurement, i == 0);
+        }
+
+        PrintMeasurement("summarize", testCount, summarizeMeasurement);
+
+        if (summary == 0)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
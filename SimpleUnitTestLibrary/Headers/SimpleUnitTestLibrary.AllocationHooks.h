@@ -0,0 +1,173 @@
+#pragma once
+
+// Opt-in allocation tracking: include this header in exactly ONE translation unit of the test executable
+// (e.g., the one defining main). It replaces the global operator new/delete family with versions that
+// update SUTL's per-thread allocation counters; every Result then carries AllocationStats, and tests
+// that return Success while leaking heap memory are reported as ResultType::LeakFailure.
+//
+// With glibc, defining SUTL_ALLOCATION_HOOKS_INCLUDE_MALLOC before including this header interposes
+// malloc/calloc/realloc/free (and the aligned variants) instead, which also covers C allocations and the
+// standard library's default operator new (so operator new is not replaced in that mode, to avoid double counting).
+//
+// This header is deliberately not part of SimpleUnitTestLibrary.h, nor a module: replacement allocation
+// functions must be defined exactly once per program.
+
+#if !defined(SUTL_USE_MODULES)
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "SimpleUnitTestLibrary.AllocationTracking.h"
+#endif
+
+#if defined(SUTL_ALLOCATION_HOOKS_INCLUDE_MALLOC) && !defined(__GLIBC__)
+#error "SUTL_ALLOCATION_HOOKS_INCLUDE_MALLOC requires glibc"
+#endif
+
+#if defined(SUTL_ALLOCATION_HOOKS_INCLUDE_MALLOC)
+#include <malloc.h>
+
+extern "C"
+{
+    void* __libc_malloc(std::size_t size);
+    void* __libc_calloc(std::size_t count, std::size_t size);
+    void* __libc_realloc(void* p, std::size_t size);
+    void* __libc_memalign(std::size_t alignment, std::size_t size);
+    void __libc_free(void* p);
+
+    // glibc declares these noexcept in C++, so the replacements must be too.
+    // Sizes are the allocator's usable sizes, so that frees are charged exactly what their allocation was.
+    void* malloc(std::size_t size) noexcept
+    {
+        void* const p{__libc_malloc(size)};
+        if (p != nullptr)
+        {
+            SimpleUnitTestLibrary::Internal_::RecordAllocation(::malloc_usable_size(p));
+        }
+        return p;
+    }
+
+    void* calloc(std::size_t count, std::size_t size) noexcept
+    {
+        void* const p{__libc_calloc(count, size)};
+        if (p != nullptr)
+        {
+            SimpleUnitTestLibrary::Internal_::RecordAllocation(::malloc_usable_size(p));
+        }
+        return p;
+    }
+
+    void* realloc(void* pOld, std::size_t size) noexcept
+    {
+        const std::size_t oldSize{(pOld != nullptr) ? ::malloc_usable_size(pOld) : 0};
+        void* const p{__libc_realloc(pOld, size)};
+        if ((p != nullptr) || (size == 0))
+        {
+            if (pOld != nullptr)
+            {
+                SimpleUnitTestLibrary::Internal_::RecordDeallocation(oldSize);
+            }
+            if (p != nullptr)
+            {
+                SimpleUnitTestLibrary::Internal_::RecordAllocation(::malloc_usable_size(p));
+            }
+        }
+        return p;
+    }
+
+    void* memalign(std::size_t alignment, std::size_t size) noexcept
+    {
+        void* const p{__libc_memalign(alignment, size)};
+        if (p != nullptr)
+        {
+            SimpleUnitTestLibrary::Internal_::RecordAllocation(::malloc_usable_size(p));
+        }
+        return p;
+    }
+
+    void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+    {
+        return memalign(alignment, size);
+    }
+
+    int posix_memalign(void** pp, std::size_t alignment, std::size_t size) noexcept
+    {
+        if ((alignment < sizeof(void*)) || ((alignment & (alignment - 1)) != 0))
+        {
+            return EINVAL;
+        }
+
+        void* const p{memalign(alignment, size)};
+        if (p == nullptr)
+        {
+            return ENOMEM;
+        }
+
+        *pp = p;
+        return 0;
+    }
+
+    void free(void* p) noexcept
+    {
+        if (p != nullptr)
+        {
+            SimpleUnitTestLibrary::Internal_::RecordDeallocation(::malloc_usable_size(p));
+            __libc_free(p);
+        }
+    }
+}
+#else
+namespace SimpleUnitTestLibrary::Internal_
+{
+    [[nodiscard]] inline void* TrackedAllocateOrThrow(
+        const std::size_t size,
+        const std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        for (;;)
+        {
+            if (void* const p{TrackedAllocate(size, alignment)}; p != nullptr)
+            {
+                return p;
+            }
+
+            const std::new_handler newHandler{std::get_new_handler()};
+            if (newHandler == nullptr)
+            {
+                throw std::bad_alloc{};
+            }
+            newHandler();
+        }
+    }
+}
+
+void* operator new(std::size_t size) { return SimpleUnitTestLibrary::Internal_::TrackedAllocateOrThrow(size); }
+void* operator new[](std::size_t size) { return SimpleUnitTestLibrary::Internal_::TrackedAllocateOrThrow(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return SimpleUnitTestLibrary::Internal_::TrackedAllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return SimpleUnitTestLibrary::Internal_::TrackedAllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return SimpleUnitTestLibrary::Internal_::TrackedAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return SimpleUnitTestLibrary::Internal_::TrackedAllocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return SimpleUnitTestLibrary::Internal_::TrackedAllocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return SimpleUnitTestLibrary::Internal_::TrackedAllocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* p) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p); }
+void operator delete[](void* p) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p); }
+
+void operator delete(void* p, std::align_val_t alignment) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::align_val_t alignment) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p, static_cast<std::size_t>(alignment)); }
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p, static_cast<std::size_t>(alignment)); }
+void operator delete(void* p, std::align_val_t alignment, const std::nothrow_t&) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::align_val_t alignment, const std::nothrow_t&) noexcept { SimpleUnitTestLibrary::Internal_::TrackedDeallocate(p, static_cast<std::size_t>(alignment)); }
+#endif
+
+namespace SimpleUnitTestLibrary::Internal_
+{
+    [[maybe_unused]] static const bool g_cbAllocationHooksRegistered{
+        (g_bAllocationHooksInstalled.store(true, std::memory_order_relaxed), true)};
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iterator>
+#include <new>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#include "APIAnnotations.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // Heap activity of the current thread over a measured span (a test, or an AllocationScope).
+    // Only populated when allocation hooks are installed (see SimpleUnitTestLibrary.AllocationHooks.h).
+    struct AllocationStats
+    {
+        bool m_bTracked{false};
+        std::uint64_t m_AllocationCount{0};
+        std::uint64_t m_DeallocationCount{0};
+        std::uint64_t m_AllocatedBytes{0};
+
+        // Highest live heap size reached, relative to the live size at the start of the span.
+        std::uint64_t m_PeakLiveBytes{0};
+
+        // Live heap size at the end of the span minus the size at its start; positive means leaked.
+        std::int64_t m_NetLiveBytes{0};
+
+        [[nodiscard]] constexpr bool HasLeaks() const noexcept
+        {
+            return m_bTracked && (m_NetLiveBytes > 0);
+        }
+
+        template <std::output_iterator<char> OutputItT>
+        OutputItT FormatTo(_In_ OutputItT out) const
+        {
+            if (!m_bTracked)
+            {
+                return std::format_to(std::move(out), "untracked");
+            }
+
+            return std::format_to(std::move(out), "{} allocs, {} frees, {} bytes, {} peak bytes",
+                m_AllocationCount, m_DeallocationCount, m_AllocatedBytes, m_PeakLiveBytes);
+        }
+
+        [[nodiscard]] std::string ToString() const
+        {
+            std::string str;
+            FormatTo(std::back_inserter(str));
+            return str;
+        }
+    };
+
+    namespace Internal_
+    {
+        struct AllocationCounters
+        {
+            std::uint64_t m_AllocationCount;
+            std::uint64_t m_DeallocationCount;
+            std::uint64_t m_AllocatedBytes;
+
+            // Signed, as memory freed on a thread other than the one that allocated it is charged to the freeing thread.
+            std::int64_t m_LiveBytes;
+            std::int64_t m_PeakLiveBytes;
+        };
+
+        // Plain thread-locals (no atomics, no TLS init guard), so the hooks cost a few adds per allocation.
+        inline constinit thread_local AllocationCounters g_tlsAllocationCounters{};
+
+        // Set by the hooks translation unit during static initialization.
+        inline constinit std::atomic<bool> g_bAllocationHooksInstalled{false};
+
+        // Every tracked block is preceded by a header holding its size, so unsized deletes can be charged too.
+        inline constexpr std::size_t g_cAllocationHeaderSize{__STDCPP_DEFAULT_NEW_ALIGNMENT__};
+        static_assert(g_cAllocationHeaderSize >= sizeof(std::size_t));
+
+        inline void RecordAllocation(_In_ const std::size_t size) noexcept
+        {
+            AllocationCounters& counters{g_tlsAllocationCounters};
+            ++counters.m_AllocationCount;
+            counters.m_AllocatedBytes += size;
+            counters.m_LiveBytes += static_cast<std::int64_t>(size);
+            counters.m_PeakLiveBytes = std::max(counters.m_PeakLiveBytes, counters.m_LiveBytes);
+        }
+
+        inline void RecordDeallocation(_In_ const std::size_t size) noexcept
+        {
+            AllocationCounters& counters{g_tlsAllocationCounters};
+            ++counters.m_DeallocationCount;
+            counters.m_LiveBytes -= static_cast<std::int64_t>(size);
+        }
+
+        [[nodiscard]] inline void* TrackedAllocate(
+            _In_ const std::size_t size,
+            _In_ const std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__) noexcept
+        {
+            const std::size_t headerSize{std::max(g_cAllocationHeaderSize, alignment)};
+            if (size > (SIZE_MAX - (2 * headerSize)))
+            {
+                return nullptr;
+            }
+
+            std::byte* pBlock;
+            if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                pBlock = static_cast<std::byte*>(std::malloc(headerSize + size));
+            }
+            else
+            {
+#if defined(_WIN32)
+                pBlock = static_cast<std::byte*>(::_aligned_malloc(headerSize + size, alignment));
+#else
+                // aligned_alloc requires the size to be a multiple of the alignment.
+                pBlock = static_cast<std::byte*>(std::aligned_alloc(alignment, (headerSize + size + alignment - 1) & ~(alignment - 1)));
+#endif
+            }
+
+            if (pBlock == nullptr)
+            {
+                return nullptr;
+            }
+
+            std::byte* const pUser{pBlock + headerSize};
+            *reinterpret_cast<std::size_t*>(pUser - sizeof(std::size_t)) = size;
+            RecordAllocation(size);
+            return pUser;
+        }
+
+        inline void TrackedDeallocate(
+            _In_opt_ void* const p,
+            _In_ const std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__) noexcept
+        {
+            if (p == nullptr)
+            {
+                return;
+            }
+
+            std::byte* const pUser{static_cast<std::byte*>(p)};
+            RecordDeallocation(*reinterpret_cast<const std::size_t*>(pUser - sizeof(std::size_t)));
+
+            std::byte* const pBlock{pUser - std::max(g_cAllocationHeaderSize, alignment)};
+#if defined(_WIN32)
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::_aligned_free(pBlock);
+                return;
+            }
+#endif
+            std::free(pBlock);
+        }
+    }
+
+    [[nodiscard]] inline bool IsAllocationTrackingEnabled() noexcept
+    {
+        return Internal_::g_bAllocationHooksInstalled.load(std::memory_order_relaxed);
+    }
+
+    // Measures the current thread's heap activity from construction until GetStats().
+    // Scopes nest: each reports its own peak without disturbing the enclosing scope's.
+    class [[nodiscard]] AllocationScope
+    {
+    private:
+
+        Internal_::AllocationCounters m_StartCounters;
+
+    public:
+
+        AllocationScope() noexcept :
+            m_StartCounters{Internal_::g_tlsAllocationCounters}
+        {
+            Internal_::g_tlsAllocationCounters.m_PeakLiveBytes = m_StartCounters.m_LiveBytes;
+        }
+
+        AllocationScope(const AllocationScope&) = delete;
+        AllocationScope& operator=(const AllocationScope&) = delete;
+
+        ~AllocationScope() noexcept
+        {
+            Internal_::AllocationCounters& counters{Internal_::g_tlsAllocationCounters};
+            counters.m_PeakLiveBytes = std::max(counters.m_PeakLiveBytes, m_StartCounters.m_PeakLiveBytes);
+        }
+
+        [[nodiscard]] AllocationStats GetStats() const noexcept
+        {
+            if (!IsAllocationTrackingEnabled())
+            {
+                return AllocationStats{};
+            }
+
+            const Internal_::AllocationCounters& counters{Internal_::g_tlsAllocationCounters};
+            return AllocationStats{
+                .m_bTracked = true,
+                .m_AllocationCount = counters.m_AllocationCount - m_StartCounters.m_AllocationCount,
+                .m_DeallocationCount = counters.m_DeallocationCount - m_StartCounters.m_DeallocationCount,
+                .m_AllocatedBytes = counters.m_AllocatedBytes - m_StartCounters.m_AllocatedBytes,
+                .m_PeakLiveBytes = static_cast<std::uint64_t>(std::max<std::int64_t>(0, counters.m_PeakLiveBytes - m_StartCounters.m_LiveBytes)),
+                .m_NetLiveBytes = counters.m_LiveBytes - m_StartCounters.m_LiveBytes};
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,144 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+#include "APIAnnotations.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Internal_
+    {
+        // Allocates from a std::pmr::memory_resource at runtime, or with std::allocator when it has none (always the case
+        // during constant evaluation), so arena-backed strings still work in constexpr suites.
+        // Copying a container doesn't copy its resource (as with std::pmr::polymorphic_allocator): copies are heap-backed,
+        // and so can safely outlive the arena the original lives in.
+        template <typename T>
+        class ArenaAllocator
+        {
+        private:
+
+            template <typename U>
+            friend class ArenaAllocator;
+
+            std::pmr::memory_resource* m_pMemoryResource{nullptr};
+
+        public:
+
+            using value_type = T;
+
+            constexpr ArenaAllocator() noexcept = default;
+
+            constexpr explicit ArenaAllocator(_In_opt_ std::pmr::memory_resource* const pMemoryResource) noexcept :
+                m_pMemoryResource{pMemoryResource}
+            { }
+
+            template <typename U>
+            constexpr ArenaAllocator(_In_ const ArenaAllocator<U>& other) noexcept :
+                m_pMemoryResource{other.m_pMemoryResource}
+            { }
+
+            [[nodiscard]] constexpr T* allocate(_In_ const std::size_t count)
+            {
+                if not consteval
+                {
+                    if (m_pMemoryResource != nullptr)
+                    {
+                        return static_cast<T*>(m_pMemoryResource->allocate(count * sizeof(T), alignof(T)));
+                    }
+                }
+
+                return std::allocator<T>{}.allocate(count);
+            }
+
+            constexpr void deallocate(
+                _In_ T* const p,
+                _In_ const std::size_t count) noexcept
+            {
+                if not consteval
+                {
+                    if (m_pMemoryResource != nullptr)
+                    {
+                        m_pMemoryResource->deallocate(p, count * sizeof(T), alignof(T));
+                        return;
+                    }
+                }
+
+                std::allocator<T>{}.deallocate(p, count);
+            }
+
+            [[nodiscard]] constexpr ArenaAllocator select_on_container_copy_construction() const noexcept
+            {
+                return ArenaAllocator{};
+            }
+
+            template <typename U>
+            [[nodiscard]] constexpr bool operator==(_In_ const ArenaAllocator<U>& other) const noexcept
+            {
+                return m_pMemoryResource == other.m_pMemoryResource;
+            }
+        };
+
+        using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+        // Monotonic storage for the many small strings a suite or a run's results hold (e.g., test names): they're carved
+        // out of a few large blocks, and all freed at once with the arena. Blocks come from the default memory resource
+        // (std::pmr::set_default_resource), so a program can supply its own.
+        class StringArena
+        {
+        private:
+
+            std::pmr::monotonic_buffer_resource m_MemoryResource;
+
+        public:
+
+            // initialSize sizes the first block (allocated on first use), e.g., to fit everything expected in one.
+            explicit StringArena(_In_ const std::size_t initialSize) :
+                m_MemoryResource{std::max(initialSize, std::size_t{1}), std::pmr::get_default_resource()}
+            { }
+
+            // Strings and views into them are invalidated when the arena is destroyed, so it can't be copied or moved.
+            StringArena(const StringArena&) = delete;
+            StringArena& operator=(const StringArena&) = delete;
+
+            [[nodiscard]] ArenaAllocator<char> GetAllocator() noexcept
+            {
+                return ArenaAllocator<char>{&m_MemoryResource};
+            }
+        };
+
+        // No arena during constant evaluation, where the strings fall back to std::allocator.
+        [[nodiscard]] constexpr std::unique_ptr<StringArena> MakeStringArena(_In_ const std::size_t initialSize)
+        {
+            if consteval
+            {
+                return nullptr;
+            }
+            else
+            {
+                return std::make_unique<StringArena>(initialSize);
+            }
+        }
+
+        [[nodiscard]] constexpr ArenaAllocator<char> GetArenaAllocator(_In_ const std::unique_ptr<StringArena>& pStringArena) noexcept
+        {
+            return !pStringArena ? ArenaAllocator<char>{} : pStringArena->GetAllocator();
+        }
+
+        // Room for a typical test name, with allocators' capacity rounding; arenas are presized from it, and grow geometrically
+        // past that, so even badly misestimated ones only take a few blocks.
+        [[nodiscard]] constexpr std::size_t EstimateStringArenaSize(_In_ const std::size_t stringCount) noexcept
+        {
+            return stringCount * 48;
+        }
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
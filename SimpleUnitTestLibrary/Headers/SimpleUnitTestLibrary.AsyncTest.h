@@ -0,0 +1,678 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#include "SimpleUnitTestLibrary.Tags.h"
+#include "SimpleUnitTestLibrary.Test.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    class AsyncResult;
+
+    namespace Internal_
+    {
+        class EventLoop;
+
+        using AsyncClock = std::chrono::steady_clock;
+
+        // The results of one AsyncTestGenerator::RunTests call, handed from the event loop's threads to the calling thread.
+        struct AsyncTestBatch
+        {
+            std::mutex m_Mutex;
+            std::condition_variable m_CompletedCondition;
+            std::vector<std::pair<std::size_t, Result>> m_CompletedTests;
+
+            void Complete(
+                _In_ const std::size_t testIndex,
+                _Inout_ Result&& result)
+            {
+                // Notified under the lock: once the last test completes, the waiting thread may destroy the batch.
+                const std::lock_guard lock{m_Mutex};
+                m_CompletedTests.emplace_back(testIndex, std::move(result));
+                m_CompletedCondition.notify_one();
+            }
+        };
+
+        // Shared by a running async test's coroutines and whatever holds them suspended (the event loop, or an awaitable
+        // outside it). A test that times out is abandoned rather than destroyed, as it may be running or held elsewhere;
+        // its coroutines are destroyed the next time they suspend in (or are resumed by) this library.
+        struct AsyncTestState
+        {
+            std::mutex m_Mutex;
+            EventLoop& m_EventLoop;
+            AsyncTestBatch& m_Batch;
+            const std::size_t m_TestIndex;
+
+            // The test's outermost coroutine; destroying it destroys any it's awaiting. Null once destroyed.
+            std::coroutine_handle<> m_RootHandle;
+
+            bool m_bCompleted{false};
+            bool m_bAbandoned{false};
+
+            AsyncTestState(
+                _In_ EventLoop& eventLoop,
+                _In_ AsyncTestBatch& batch,
+                _In_ const std::size_t testIndex) noexcept :
+                m_EventLoop{eventLoop},
+                m_Batch{batch},
+                m_TestIndex{testIndex}
+            { }
+
+            // Callers hold m_Mutex, and release it before destroying the returned handle (which may free this state).
+            [[nodiscard]] std::coroutine_handle<> ReleaseRootHandleLocked() noexcept
+            {
+                return std::exchange(m_RootHandle, nullptr);
+            }
+
+            // Gives up on a test that hasn't completed, returning false if it has (its result is then with m_Batch).
+            [[nodiscard]] bool Abandon()
+            {
+                const std::lock_guard lock{m_Mutex};
+                if (m_bCompleted)
+                {
+                    return false;
+                }
+
+                m_bAbandoned = true;
+                return true;
+            }
+        };
+
+        // Resumes suspended async tests on a few threads, as they become ready or their timers expire, so thousands of
+        // tests waiting on timers or I/O cost a coroutine frame each rather than a thread each.
+        // Threads only start once something is scheduled, so an idle event loop is free.
+        class EventLoop
+        {
+        private:
+
+            struct ScheduledResume
+            {
+                AsyncClock::time_point m_ResumeTime;
+                std::coroutine_handle<> m_Handle;
+                std::shared_ptr<AsyncTestState> m_pState;
+
+                [[nodiscard]] bool operator>(_In_ const ScheduledResume& other) const noexcept
+                {
+                    return m_ResumeTime > other.m_ResumeTime;
+                }
+            };
+
+            const std::uint32_t m_ThreadCount;
+
+            std::mutex m_Mutex;
+            std::condition_variable_any m_WakeCondition;
+            std::deque<ScheduledResume> m_ReadyQueue;
+
+            // A min-heap on m_ResumeTime.
+            std::vector<ScheduledResume> m_Timers;
+
+            // Bumped by every Schedule, so waiting threads notice a new timer earlier than the one they're waiting for.
+            std::uint64_t m_ScheduleCount{0};
+
+            std::once_flag m_StartFlag;
+
+            // Last, so everything above is initialized before the threads start (and outlives them).
+            std::vector<std::jthread> m_Threads;
+
+            static void Resume(_In_ const ScheduledResume& scheduledResume)
+            {
+                AsyncTestState& state{*scheduledResume.m_pState};
+                std::unique_lock stateLock{state.m_Mutex};
+                if (state.m_bAbandoned)
+                {
+                    const std::coroutine_handle<> rootHandle{state.ReleaseRootHandleLocked()};
+                    stateLock.unlock();
+                    if (!!rootHandle)
+                    {
+                        rootHandle.destroy();
+                    }
+
+                    return;
+                }
+
+                stateLock.unlock();
+                scheduledResume.m_Handle.resume();
+            }
+
+            void Run(_In_ const std::stop_token stopToken)
+            {
+                std::unique_lock lock{m_Mutex};
+                while (!stopToken.stop_requested())
+                {
+                    const AsyncClock::time_point now{AsyncClock::now()};
+                    while (!m_Timers.empty() && (m_Timers.front().m_ResumeTime <= now))
+                    {
+                        std::ranges::pop_heap(m_Timers, std::greater{});
+                        m_ReadyQueue.push_back(std::move(m_Timers.back()));
+                        m_Timers.pop_back();
+                    }
+
+                    if (!m_ReadyQueue.empty())
+                    {
+                        const ScheduledResume scheduledResume{std::move(m_ReadyQueue.front())};
+                        m_ReadyQueue.pop_front();
+
+                        lock.unlock();
+                        {
+                            const ForkGateWorkScope forkGateWorkScope;
+                            Resume(scheduledResume);
+                        }
+                        lock.lock();
+                        continue;
+                    }
+
+                    const std::uint64_t scheduleCount{m_ScheduleCount};
+                    auto IsScheduled = [this, scheduleCount]() { return m_ScheduleCount != scheduleCount; };
+                    if (m_Timers.empty())
+                    {
+                        m_WakeCondition.wait(lock, stopToken, IsScheduled);
+                    }
+                    else
+                    {
+                        // A copy, as m_Timers can change while this thread waits.
+                        const AsyncClock::time_point wakeTime{m_Timers.front().m_ResumeTime};
+                        m_WakeCondition.wait_until(lock, stopToken, wakeTime, IsScheduled);
+                    }
+                }
+            }
+
+        public:
+
+            // Zero threads means a few: up to 4, fewer on smaller machines.
+            explicit EventLoop(_In_ const std::uint32_t threadCount = 0) :
+                m_ThreadCount{(threadCount != 0) ? threadCount : std::clamp(std::thread::hardware_concurrency(), 1u, 4u)}
+            { }
+
+            EventLoop(const EventLoop&) = delete;
+            EventLoop& operator=(const EventLoop&) = delete;
+
+            // Whatever is still scheduled belongs to abandoned tests, and is destroyed once the threads have stopped.
+            ~EventLoop() noexcept
+            {
+                for (std::jthread& thread : m_Threads)
+                {
+                    thread.request_stop();
+                }
+                m_Threads.clear();
+
+                auto DestroyTest = [](_In_ const ScheduledResume& scheduledResume)
+                {
+                    std::unique_lock stateLock{scheduledResume.m_pState->m_Mutex};
+                    const std::coroutine_handle<> rootHandle{scheduledResume.m_pState->ReleaseRootHandleLocked()};
+                    stateLock.unlock();
+                    if (!!rootHandle)
+                    {
+                        rootHandle.destroy();
+                    }
+                };
+                std::ranges::for_each(m_ReadyQueue, DestroyTest);
+                std::ranges::for_each(m_Timers, DestroyTest);
+            }
+
+            [[nodiscard]] std::uint32_t GetThreadCount() const noexcept
+            {
+                return m_ThreadCount;
+            }
+
+            // Resumes handle on one of the loop's threads at (or soon after) resumeTime; a time already past means
+            // as soon as a thread is free.
+            void Schedule(
+                _In_ const AsyncClock::time_point resumeTime,
+                _In_ const std::coroutine_handle<> handle,
+                _In_ std::shared_ptr<AsyncTestState> pState)
+            {
+                std::call_once(m_StartFlag,
+                    [this]()
+                    {
+                        m_Threads.reserve(m_ThreadCount);
+                        for (std::uint32_t i = 0; i < m_ThreadCount; ++i)
+                        {
+                            m_Threads.emplace_back([this](_In_ const std::stop_token stopToken) { Run(stopToken); });
+                        }
+                    });
+
+                const std::lock_guard lock{m_Mutex};
+                if (resumeTime <= AsyncClock::now())
+                {
+                    m_ReadyQueue.push_back(ScheduledResume{resumeTime, handle, std::move(pState)});
+                }
+                else
+                {
+                    m_Timers.push_back(ScheduledResume{resumeTime, handle, std::move(pState)});
+                    std::ranges::push_heap(m_Timers, std::greater{});
+                }
+
+                ++m_ScheduleCount;
+                m_WakeCondition.notify_one();
+            }
+        };
+
+        // Runner's event loop while it runs suites; async tests run elsewhere get an event loop of their own.
+        inline std::atomic<EventLoop*> g_pActiveEventLoop{nullptr};
+
+        [[nodiscard]] inline EventLoop* GetActiveEventLoop() noexcept
+        {
+            return g_pActiveEventLoop.load(std::memory_order_acquire);
+        }
+    }
+
+    // The return type of an async test (or of a coroutine an async test awaits), which co_returns its Result, e.g.:
+    //   SUTL::AsyncResult ReadTest()
+    //   {
+    //       const std::string contents{co_await ReadFileAsync("input.txt")};
+    //       co_await SUTL::SleepFor(10ms);
+    //       SUTL_CO_TEST_ASSERT(contents == "expected");
+    //       SUTL_CO_TEST_SUCCESS();
+    //   }
+    // An exception escaping the coroutine becomes an UnhandledException result. co_await on another AsyncResult runs
+    // it to completion and yields its Result.
+    class [[nodiscard]] AsyncResult
+    {
+    public:
+
+        struct promise_type
+        {
+            Result m_Result;
+
+            // Set before the coroutine first runs; shared with the coroutines it awaits.
+            std::shared_ptr<Internal_::AsyncTestState> m_pState;
+
+            // The coroutine awaiting this one, if any; it's resumed in its place when this one finishes.
+            std::coroutine_handle<> m_ContinuationHandle;
+
+            struct FinalAwaiter
+            {
+                [[nodiscard]] bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                [[nodiscard]] std::coroutine_handle<> await_suspend(_In_ const std::coroutine_handle<promise_type> handle) const noexcept
+                {
+                    promise_type& promise{handle.promise()};
+                    if (!!promise.m_ContinuationHandle)
+                    {
+                        return promise.m_ContinuationHandle;
+                    }
+
+                    // The test is over: hand its result over (unless it was abandoned), and free its coroutine.
+                    const std::shared_ptr<Internal_::AsyncTestState> pState{promise.m_pState};
+                    std::unique_lock stateLock{pState->m_Mutex};
+                    if (!pState->m_bAbandoned)
+                    {
+                        pState->m_bCompleted = true;
+                        pState->m_Batch.Complete(pState->m_TestIndex, std::move(promise.m_Result));
+                    }
+
+                    const std::coroutine_handle<> rootHandle{pState->ReleaseRootHandleLocked()};
+                    stateLock.unlock();
+                    if (!!rootHandle)
+                    {
+                        rootHandle.destroy();
+                    }
+
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept
+                { }
+            };
+
+            [[nodiscard]] AsyncResult get_return_object() noexcept
+            {
+                return AsyncResult{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            // Started by the event loop (or the coroutine awaiting it), not the caller.
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            [[nodiscard]] FinalAwaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void return_value(_Inout_ Result result) noexcept
+            {
+                m_Result = std::move(result);
+            }
+
+            void unhandled_exception() noexcept
+            {
+                try
+                {
+                    throw;
+                }
+                catch (const std::exception& e)
+                {
+                    m_Result = Result{ResultType::UnhandledException, std::source_location::current(), e.what()};
+                }
+                catch (...)
+                {
+                    m_Result = Result{ResultType::UnhandledException, std::source_location::current(), "Unknown exception"};
+                }
+            }
+        };
+
+    private:
+
+        std::coroutine_handle<promise_type> m_Handle;
+
+        explicit AsyncResult(_In_ const std::coroutine_handle<promise_type> handle) noexcept :
+            m_Handle{handle}
+        { }
+
+    public:
+
+        AsyncResult(_Inout_ AsyncResult&& other) noexcept :
+            m_Handle{std::exchange(other.m_Handle, nullptr)}
+        { }
+
+        AsyncResult& operator=(_Inout_ AsyncResult&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (!!m_Handle)
+                {
+                    m_Handle.destroy();
+                }
+
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+            }
+
+            return *this;
+        }
+
+        ~AsyncResult() noexcept
+        {
+            if (!!m_Handle)
+            {
+                m_Handle.destroy();
+            }
+        }
+
+        // Gives up ownership of the coroutine, e.g., to the event loop running it as a test.
+        [[nodiscard]] std::coroutine_handle<promise_type> Release() noexcept
+        {
+            return std::exchange(m_Handle, nullptr);
+        }
+
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> m_Handle;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            // Symmetric transfer: the awaited coroutine runs right away, on this thread, and resumes its awaiter when it's done.
+            [[nodiscard]] std::coroutine_handle<> await_suspend(_In_ const std::coroutine_handle<promise_type> awaitingHandle) const noexcept
+            {
+                m_Handle.promise().m_pState = awaitingHandle.promise().m_pState;
+                m_Handle.promise().m_ContinuationHandle = awaitingHandle;
+                return m_Handle;
+            }
+
+            [[nodiscard]] Result await_resume() const noexcept
+            {
+                return std::move(m_Handle.promise().m_Result);
+            }
+        };
+
+        // Only async tests (and the coroutines they await) can co_await an AsyncResult.
+        [[nodiscard]] Awaiter operator co_await() const & noexcept
+        {
+            return Awaiter{m_Handle};
+        }
+    };
+
+    namespace Internal_
+    {
+        // Suspends an async test until resumeTime on its event loop, or, if it has been abandoned, destroys it.
+        // For awaitables' await_suspend, which must not touch their (destroyed) coroutine afterwards.
+        inline void ScheduleAsyncTest(
+            _In_ const std::coroutine_handle<AsyncResult::promise_type> handle,
+            _In_ const AsyncClock::time_point resumeTime)
+        {
+            const std::shared_ptr<AsyncTestState> pState{handle.promise().m_pState};
+            std::unique_lock stateLock{pState->m_Mutex};
+            if (pState->m_bAbandoned)
+            {
+                const std::coroutine_handle<> rootHandle{pState->ReleaseRootHandleLocked()};
+                stateLock.unlock();
+                if (!!rootHandle)
+                {
+                    rootHandle.destroy();
+                }
+
+                return;
+            }
+
+            pState->m_EventLoop.Schedule(resumeTime, handle, pState);
+        }
+
+        struct ScheduleAwaiter
+        {
+            AsyncClock::time_point m_ResumeTime;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(_In_ const std::coroutine_handle<AsyncResult::promise_type> handle) const
+            {
+                ScheduleAsyncTest(handle, m_ResumeTime);
+            }
+
+            void await_resume() const noexcept
+            { }
+        };
+    }
+
+    // Suspends an async test for duration, freeing its event loop thread for other tests meanwhile.
+    [[nodiscard]] inline Internal_::ScheduleAwaiter SleepFor(_In_ const Internal_::AsyncClock::duration duration) noexcept
+    {
+        return Internal_::ScheduleAwaiter{Internal_::AsyncClock::now() + duration};
+    }
+
+    // Moves an async test back onto its event loop, e.g., after awaiting an operation completed on some other thread
+    // (say, an I/O library's), so that thread isn't kept running the rest of the test.
+    [[nodiscard]] inline Internal_::ScheduleAwaiter ResumeOnEventLoop() noexcept
+    {
+        return Internal_::ScheduleAwaiter{Internal_::AsyncClock::time_point::min()};
+    }
+
+    using AsyncTestFunction = AsyncResult(*)();
+
+    // An async test, e.g., SUTL_CREATE_ASYNC_TEST(ReadTest), or SUTL::AsyncTest{"ReadTest", ReadTest, {}, 500ms} for a
+    // shorter timeout. A test still running at its timeout fails (see AsyncTestState for what becomes of it).
+    struct AsyncTest
+    {
+        std::string m_TestName;
+        AsyncTestFunction m_TestFn{};
+        TestTags m_Tags{};
+        std::chrono::milliseconds m_Timeout{std::chrono::seconds{30}};
+        std::source_location m_SourceLocation{std::source_location::current()};
+    };
+
+    // Runs async tests together on an event loop (Runner's while it runs; otherwise one of its own): each test starts
+    // in turn, and runs on a loop thread until it awaits, so thousands of waiting tests interleave on a few threads.
+    // Tests of one suite may therefore run concurrently with each other. Their results are the same as a TestFunction's,
+    // though without allocation tracking or hardware counters, which can't be attributed to interleaved tests.
+    class AsyncTestGenerator final : public TestGenerator
+    {
+    private:
+
+        std::vector<AsyncTest> m_Tests;
+
+        struct PendingTest
+        {
+            Internal_::AsyncClock::time_point m_Deadline;
+            std::size_t m_TestIndex;
+            std::shared_ptr<Internal_::AsyncTestState> m_pState;
+
+            [[nodiscard]] bool operator>(_In_ const PendingTest& other) const noexcept
+            {
+                return m_Deadline > other.m_Deadline;
+            }
+        };
+
+    public:
+
+        explicit AsyncTestGenerator(_Inout_ std::vector<AsyncTest> tests) noexcept :
+            m_Tests{std::move(tests)}
+        { }
+
+        [[nodiscard]] std::size_t GetTestCount() const override
+        {
+            return m_Tests.size();
+        }
+
+        void FormatTestName(
+            _In_ const std::size_t testIndex,
+            _Inout_ std::string& testName) const override
+        {
+            testName = m_Tests[testIndex].m_TestName;
+        }
+
+        [[nodiscard]] TestTags GetTestTags(_In_ const std::size_t testIndex) const override
+        {
+            return m_Tests[testIndex].m_Tags;
+        }
+
+        [[nodiscard]] Result RunTest(_In_ const std::size_t testIndex) const override
+        {
+            Result result;
+            auto OnTestBegin = [](_In_ const std::size_t) { };
+            auto OnTestEnd = [&result](_In_ const std::size_t, _Inout_ Result&& testResult) { result = std::move(testResult); };
+            Internal_::TestResultSinkFn resultSink{OnTestBegin, OnTestEnd};
+            RunTests(std::span{&testIndex, 1}, resultSink);
+            return result;
+        }
+
+        void RunTests(
+            _In_ const std::span<const std::size_t> testIndices,
+            _Inout_ TestResultSink& resultSink) const override
+        {
+            std::optional<Internal_::EventLoop> localEventLoop;
+            Internal_::EventLoop* pEventLoop{Internal_::GetActiveEventLoop()};
+            if (pEventLoop == nullptr)
+            {
+                pEventLoop = &localEventLoop.emplace();
+            }
+
+            // Destroyed last: abandoned tests' state refers to it, but never touches it once abandoned.
+            Internal_::AsyncTestBatch batch;
+
+            // A min-heap on m_Deadline; entries for tests that have since completed are skipped as they come up.
+            std::vector<PendingTest> pendingTests;
+            pendingTests.reserve(testIndices.size());
+            for (const std::size_t testIndex : testIndices)
+            {
+                const AsyncTest& test{m_Tests[testIndex]};
+                resultSink.OnTestBegin(testIndex);
+
+                std::coroutine_handle<AsyncResult::promise_type> handle;
+                try
+                {
+                    handle = std::invoke(test.m_TestFn).Release();
+                }
+                catch (const std::exception& e)
+                {
+                    resultSink.OnTestEnd(testIndex, Result{ResultType::UnhandledException, test.m_SourceLocation, e.what()});
+                    continue;
+                }
+
+                auto pState{std::make_shared<Internal_::AsyncTestState>(*pEventLoop, batch, testIndex)};
+                pState->m_RootHandle = handle;
+                handle.promise().m_pState = pState;
+
+                pendingTests.push_back(PendingTest{Internal_::AsyncClock::now() + test.m_Timeout, testIndex, pState});
+                std::ranges::push_heap(pendingTests, std::greater{});
+                pEventLoop->Schedule(Internal_::AsyncClock::time_point::min(), handle, std::move(pState));
+            }
+
+            std::size_t remainingCount{pendingTests.size()};
+            std::vector<std::pair<std::size_t, Result>> completedTests;
+            while (remainingCount != 0)
+            {
+                {
+                    // Every test that's left may have completed already, with only its result still to collect.
+                    auto IsCompleted = [&batch]() { return !batch.m_CompletedTests.empty(); };
+                    std::unique_lock lock{batch.m_Mutex};
+                    if (pendingTests.empty())
+                    {
+                        batch.m_CompletedCondition.wait(lock, IsCompleted);
+                    }
+                    else
+                    {
+                        batch.m_CompletedCondition.wait_until(lock, pendingTests.front().m_Deadline, IsCompleted);
+                    }
+                    completedTests.swap(batch.m_CompletedTests);
+                }
+
+                for (auto& [testIndex, result] : completedTests)
+                {
+                    resultSink.OnTestEnd(testIndex, std::move(result));
+                    --remainingCount;
+                }
+                completedTests.clear();
+
+                const Internal_::AsyncClock::time_point now{Internal_::AsyncClock::now()};
+                while (!pendingTests.empty() && (pendingTests.front().m_Deadline <= now))
+                {
+                    std::ranges::pop_heap(pendingTests, std::greater{});
+                    const PendingTest pendingTest{std::move(pendingTests.back())};
+                    pendingTests.pop_back();
+                    if (pendingTest.m_pState->Abandon())
+                    {
+                        const AsyncTest& test{m_Tests[pendingTest.m_TestIndex]};
+                        resultSink.OnTestEnd(pendingTest.m_TestIndex, Result{
+                            ResultType::TestFailure,
+                            test.m_SourceLocation,
+                            std::format("Timed out after {} ms", test.m_Timeout.count())});
+                        --remainingCount;
+                    }
+                }
+            }
+        }
+    };
+
+    // E.g., SUTL::Suite{"IoSuite", SUTL::MakeAsyncTests({SUTL_CREATE_ASYNC_TEST(ReadTest), SUTL_CREATE_ASYNC_TEST(WriteTest)})}
+    [[nodiscard]] inline std::unique_ptr<const TestGenerator> MakeAsyncTests(_Inout_ std::vector<AsyncTest> tests)
+    {
+        return std::make_unique<const AsyncTestGenerator>(std::move(tests));
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,542 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.MappedFile.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // Compact, versioned result file meant to be written by (sharded) workers and read back with a memory mapping:
+    //
+    //   BinaryResultsHeader
+    //   BinarySuiteRecord[m_SuiteCount]
+    //   BinaryTestRecord[m_TestCount]
+    //   char[m_StringTableSize]         (names, file names, and info strings; deduplicated, not NUL-terminated)
+    //
+    // All integers are little-endian and every record is naturally aligned relative to the start of the file.
+    // Bump g_cBinaryResultsVersion whenever a record's layout or ResultType/TestStage changes.
+    inline constexpr std::uint32_t g_cBinaryResultsVersion{1};
+    inline constexpr std::array<char, 8> g_cBinaryResultsMagic{'S', 'U', 'T', 'L', 'R', 'E', 'S', '\0'};
+
+    static_assert(std::endian::native == std::endian::little, "Binary results are only supported on little-endian targets.");
+
+    struct BinaryStringRef
+    {
+        std::uint32_t m_Offset{0};
+        std::uint32_t m_Length{0};
+    };
+
+    struct BinaryResultsHeader
+    {
+        std::array<char, 8> m_Magic{g_cBinaryResultsMagic};
+        std::uint32_t m_Version{g_cBinaryResultsVersion};
+        std::uint32_t m_ResultTypeCount{static_cast<std::uint32_t>(ResultType::_End)};
+        std::uint64_t m_SuiteCount{0};
+        std::uint64_t m_TestCount{0};
+        std::uint64_t m_StringTableSize{0};
+    };
+
+    struct BinarySuiteRecord
+    {
+        BinaryStringRef m_Name;
+        std::uint64_t m_DurationNs{0};
+
+        // Covers every test in the suite, including ones without a BinaryTestRecord (see Reporter::OnSuiteEnd).
+        ResultTypeCounts m_ResultTypeCounts{};
+    };
+
+    struct BinaryTestRecord
+    {
+        std::uint64_t m_DurationNs{0};
+        std::uint32_t m_SuiteIndex{0};
+        std::uint32_t m_Line{0};
+        BinaryStringRef m_Name;
+        BinaryStringRef m_File;
+        BinaryStringRef m_Info;
+        ResultType m_ResultType{ResultType::NotRun};
+        TestStage m_Stage{TestStage::Test};
+
+        // Explicit (zeroed) so no indeterminate padding bytes reach the file.
+        std::array<std::uint8_t, 3> m_Reserved{};
+    };
+
+    static_assert(std::has_unique_object_representations_v<BinaryResultsHeader> && (sizeof(BinaryResultsHeader) == 40));
+    static_assert(std::has_unique_object_representations_v<BinarySuiteRecord> && (sizeof(BinarySuiteRecord) % 8 == 0));
+    static_assert(std::has_unique_object_representations_v<BinaryTestRecord> && (sizeof(BinaryTestRecord) == 48));
+
+    namespace Internal_
+    {
+        // Lets string-keyed maps be probed with a string_view without allocating.
+        struct TransparentStringHash
+        {
+            using is_transparent = void;
+
+            [[nodiscard]] std::size_t operator()(_In_ const std::string_view textSV) const noexcept
+            {
+                return std::hash<std::string_view>{}(textSV);
+            }
+        };
+    }
+
+    // Accumulates records in memory and serializes them in one piece (a single buffered append for a worker).
+    class BinaryResultsWriter
+    {
+    private:
+
+        std::vector<BinarySuiteRecord> m_Suites;
+        std::vector<BinaryTestRecord> m_Tests;
+        std::string m_StringTable;
+        std::unordered_map<std::string, BinaryStringRef, Internal_::TransparentStringHash, std::equal_to<>> m_InternedStrings;
+
+        template <typename T>
+        static void AppendBytes(
+            _Inout_ std::string& buffer,
+            _In_ const std::span<const T> records)
+        {
+            buffer.append(reinterpret_cast<const char*>(records.data()), records.size_bytes());
+        }
+
+    public:
+
+        [[nodiscard]] BinaryStringRef Intern(_In_ const std::string_view textSV)
+        {
+            if (textSV.empty())
+            {
+                return {};
+            }
+
+            if (const auto it = m_InternedStrings.find(textSV); it != m_InternedStrings.end())
+            {
+                return it->second;
+            }
+
+            const BinaryStringRef stringRef{static_cast<std::uint32_t>(m_StringTable.size()), static_cast<std::uint32_t>(textSV.size())};
+            m_StringTable += textSV;
+            m_InternedStrings.emplace(textSV, stringRef);
+            return stringRef;
+        }
+
+        [[nodiscard]] std::uint32_t AddSuite(_In_ const std::string_view suiteNameSV)
+        {
+            m_Suites.push_back(BinarySuiteRecord{.m_Name = Intern(suiteNameSV)});
+            return static_cast<std::uint32_t>(m_Suites.size() - 1);
+        }
+
+        [[nodiscard]] BinarySuiteRecord& GetSuite(_In_ const std::uint32_t suiteIndex) noexcept
+        {
+            return m_Suites[suiteIndex];
+        }
+
+        void AddTest(
+            _In_ const std::uint32_t suiteIndex,
+            _In_ const std::string_view testNameSV,
+            _In_ const std::string_view fileSV,
+            _In_ const std::uint32_t line,
+            _In_ const TestStage testStage,
+            _In_ const ResultType resultType,
+            _In_ const std::uint64_t durationNs,
+            _In_ const std::string_view infoSV)
+        {
+            m_Tests.push_back(BinaryTestRecord{
+                .m_DurationNs = durationNs,
+                .m_SuiteIndex = suiteIndex,
+                .m_Line = line,
+                .m_Name = Intern(testNameSV),
+                .m_File = Intern(fileSV),
+                .m_Info = Intern(infoSV),
+                .m_ResultType = resultType,
+                .m_Stage = testStage});
+        }
+
+        [[nodiscard]] std::size_t GetSerializedSize() const noexcept
+        {
+            return sizeof(BinaryResultsHeader)
+                + (m_Suites.size() * sizeof(BinarySuiteRecord))
+                + (m_Tests.size() * sizeof(BinaryTestRecord))
+                + m_StringTable.size();
+        }
+
+        void AppendTo(_Inout_ std::string& buffer) const
+        {
+            const BinaryResultsHeader header{
+                .m_SuiteCount = m_Suites.size(),
+                .m_TestCount = m_Tests.size(),
+                .m_StringTableSize = m_StringTable.size()};
+
+            buffer.reserve(buffer.size() + GetSerializedSize());
+            AppendBytes(buffer, std::span{&header, 1});
+            AppendBytes(buffer, std::span{m_Suites});
+            AppendBytes(buffer, std::span{m_Tests});
+            buffer += m_StringTable;
+        }
+    };
+
+    // Read-only view of a binary results file; records are read in place from the mapping.
+    // Construction never throws; check operator bool / GetErrorMessage() before use.
+    class [[nodiscard]] BinaryResultsFile
+    {
+    private:
+
+        MappedFile m_MappedFile;
+        std::string_view m_ErrorMessageSV;
+        std::span<const BinarySuiteRecord> m_Suites;
+        std::span<const BinaryTestRecord> m_Tests;
+        std::string_view m_StringTable;
+
+        void Parse() noexcept
+        {
+            if (!m_MappedFile)
+            {
+                m_ErrorMessageSV = "unable to map file";
+                return;
+            }
+
+            const std::span<const std::byte> bytes{m_MappedFile.GetBytes()};
+            if (bytes.size() < sizeof(BinaryResultsHeader))
+            {
+                m_ErrorMessageSV = "file is too small";
+                return;
+            }
+
+            BinaryResultsHeader header;
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            if (header.m_Magic != g_cBinaryResultsMagic)
+            {
+                m_ErrorMessageSV = "not a binary results file";
+                return;
+            }
+
+            if ((header.m_Version != g_cBinaryResultsVersion) || (header.m_ResultTypeCount != static_cast<std::uint32_t>(ResultType::_End)))
+            {
+                m_ErrorMessageSV = "unsupported binary results version";
+                return;
+            }
+
+            // Checked piecewise so corrupt counts can't overflow the size computation.
+            std::size_t remainingSize{bytes.size() - sizeof(BinaryResultsHeader)};
+            if ((header.m_SuiteCount > remainingSize / sizeof(BinarySuiteRecord))
+                || (header.m_TestCount > (remainingSize -= header.m_SuiteCount * sizeof(BinarySuiteRecord)) / sizeof(BinaryTestRecord))
+                || (header.m_StringTableSize != (remainingSize - header.m_TestCount * sizeof(BinaryTestRecord))))
+            {
+                m_ErrorMessageSV = "file is truncated or corrupt";
+                return;
+            }
+
+            const std::byte* pData{bytes.data() + sizeof(BinaryResultsHeader)};
+            m_Suites = {reinterpret_cast<const BinarySuiteRecord*>(pData), static_cast<std::size_t>(header.m_SuiteCount)};
+            pData += m_Suites.size_bytes();
+            m_Tests = {reinterpret_cast<const BinaryTestRecord*>(pData), static_cast<std::size_t>(header.m_TestCount)};
+            pData += m_Tests.size_bytes();
+            m_StringTable = {reinterpret_cast<const char*>(pData), static_cast<std::size_t>(header.m_StringTableSize)};
+        }
+
+    public:
+
+        explicit BinaryResultsFile(_In_ std::filesystem::path path) noexcept :
+            m_MappedFile{std::move(path)}
+        {
+            Parse();
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return m_ErrorMessageSV.empty();
+        }
+
+        [[nodiscard]] std::string_view GetErrorMessage() const noexcept
+        {
+            return m_ErrorMessageSV;
+        }
+
+        [[nodiscard]] const MappedFile& GetMappedFile() const noexcept
+        {
+            return m_MappedFile;
+        }
+
+        [[nodiscard]] std::span<const BinarySuiteRecord> GetSuites() const noexcept
+        {
+            return m_Suites;
+        }
+
+        [[nodiscard]] std::span<const BinaryTestRecord> GetTests() const noexcept
+        {
+            return m_Tests;
+        }
+
+        // Out-of-range references (i.e., a corrupt file) yield an empty string rather than reading past the table.
+        [[nodiscard]] std::string_view GetString(_In_ const BinaryStringRef stringRef) const noexcept
+        {
+            if ((stringRef.m_Offset > m_StringTable.size()) || (stringRef.m_Length > m_StringTable.size() - stringRef.m_Offset))
+            {
+                return {};
+            }
+
+            return m_StringTable.substr(stringRef.m_Offset, stringRef.m_Length);
+        }
+
+        [[nodiscard]] std::string_view GetSuiteName(_In_ const BinaryTestRecord& testRecord) const noexcept
+        {
+            return (testRecord.m_SuiteIndex < m_Suites.size()) ? GetString(m_Suites[testRecord.m_SuiteIndex].m_Name) : std::string_view{};
+        }
+    };
+
+    [[nodiscard]] constexpr bool IsFailureResultType(_In_ const ResultType resultType) noexcept
+    {
+        return (resultType != ResultType::NotRun)
+            && (resultType != ResultType::Success)
+            && (resultType != ResultType::Skipped);
+    }
+
+    // Identifies a test across runs (and across shards): "<suite>/<test>/<stage>".
+    [[nodiscard]] inline std::string MakeBinaryTestKey(
+        _In_ const BinaryResultsFile& file,
+        _In_ const BinaryTestRecord& testRecord)
+    {
+        std::string key{file.GetSuiteName(testRecord)};
+        key += '/';
+        key += file.GetString(testRecord.m_Name);
+        key += '/';
+        key += TestStageToString(testRecord.m_Stage);
+        return key;
+    }
+
+    // Combines result files (e.g., one per shard) into one; same-named suites are combined, their counts and durations summed.
+    class BinaryResultsMerger
+    {
+    private:
+
+        BinaryResultsWriter m_ResultsWriter;
+        std::unordered_map<std::string, std::uint32_t, Internal_::TransparentStringHash, std::equal_to<>> m_SuiteIndices;
+        std::vector<std::uint32_t> m_SuiteIndexRemap;
+        std::uint64_t m_TestCount{0};
+
+    public:
+
+        void Add(_In_ const BinaryResultsFile& file)
+        {
+            m_SuiteIndexRemap.clear();
+            for (const BinarySuiteRecord& suiteRecord : file.GetSuites())
+            {
+                const std::string_view suiteNameSV{file.GetString(suiteRecord.m_Name)};
+                auto it{m_SuiteIndices.find(suiteNameSV)};
+                if (it == m_SuiteIndices.end())
+                {
+                    it = m_SuiteIndices.emplace(std::string{suiteNameSV}, m_ResultsWriter.AddSuite(suiteNameSV)).first;
+                }
+
+                BinarySuiteRecord& mergedSuiteRecord{m_ResultsWriter.GetSuite(it->second)};
+                mergedSuiteRecord.m_DurationNs += suiteRecord.m_DurationNs;
+                for (std::size_t i = 0; i < mergedSuiteRecord.m_ResultTypeCounts.size(); ++i)
+                {
+                    mergedSuiteRecord.m_ResultTypeCounts[i] += suiteRecord.m_ResultTypeCounts[i];
+                }
+                m_SuiteIndexRemap.push_back(it->second);
+            }
+
+            for (const BinaryTestRecord& testRecord : file.GetTests())
+            {
+                if (testRecord.m_SuiteIndex >= m_SuiteIndexRemap.size())
+                {
+                    continue;
+                }
+
+                m_ResultsWriter.AddTest(
+                    m_SuiteIndexRemap[testRecord.m_SuiteIndex],
+                    file.GetString(testRecord.m_Name),
+                    file.GetString(testRecord.m_File),
+                    testRecord.m_Line,
+                    testRecord.m_Stage,
+                    testRecord.m_ResultType,
+                    testRecord.m_DurationNs,
+                    file.GetString(testRecord.m_Info));
+                ++m_TestCount;
+            }
+        }
+
+        [[nodiscard]] std::size_t GetSuiteCount() const noexcept
+        {
+            return m_SuiteIndices.size();
+        }
+
+        [[nodiscard]] std::uint64_t GetTestCount() const noexcept
+        {
+            return m_TestCount;
+        }
+
+        void AppendTo(_Inout_ std::string& buffer) const
+        {
+            m_ResultsWriter.AppendTo(buffer);
+        }
+    };
+
+    enum class BinaryResultChange : std::uint8_t
+    {
+        Added,     // Only in the new file.
+        Removed,   // Only in the base file.
+        Regressed, // Passing (or not run) in the base file, failing in the new one.
+        Fixed,     // Failing in the base file, passing (or not run) in the new one.
+        Changed    // Some other change, e.g., one kind of failure to another.
+    };
+
+    struct BinaryResultDifference
+    {
+        BinaryResultChange m_Change{BinaryResultChange::Changed};
+        std::string m_TestKey; // See MakeBinaryTestKey.
+        ResultType m_BaseResultType{ResultType::NotRun};
+        ResultType m_NewResultType{ResultType::NotRun};
+        std::string_view m_NewInfoSV; // Points into the new file.
+    };
+
+    // Tests (matched by MakeBinaryTestKey) whose result changed, appeared, or disappeared between two runs; tests with
+    // the same result in both are left out. Added/changed tests come in the new file's order, then the removed ones.
+    [[nodiscard]] inline std::vector<BinaryResultDifference> DiffBinaryResults(
+        _In_ const BinaryResultsFile& baseFile,
+        _In_ const BinaryResultsFile& newFile)
+    {
+        std::unordered_map<std::string, const BinaryTestRecord*, Internal_::TransparentStringHash, std::equal_to<>> baseTests;
+        baseTests.reserve(baseFile.GetTests().size());
+        for (const BinaryTestRecord& testRecord : baseFile.GetTests())
+        {
+            baseTests.insert_or_assign(MakeBinaryTestKey(baseFile, testRecord), &testRecord);
+        }
+
+        std::vector<BinaryResultDifference> differences;
+        for (const BinaryTestRecord& testRecord : newFile.GetTests())
+        {
+            BinaryResultDifference difference{
+                .m_TestKey = MakeBinaryTestKey(newFile, testRecord),
+                .m_NewResultType = testRecord.m_ResultType,
+                .m_NewInfoSV = newFile.GetString(testRecord.m_Info)};
+
+            const auto it{baseTests.find(difference.m_TestKey)};
+            if (it == baseTests.end())
+            {
+                difference.m_Change = BinaryResultChange::Added;
+                differences.push_back(std::move(difference));
+                continue;
+            }
+
+            difference.m_BaseResultType = it->second->m_ResultType;
+            baseTests.erase(it);
+            if (difference.m_BaseResultType == difference.m_NewResultType)
+            {
+                continue;
+            }
+
+            const bool bBaseFailed{IsFailureResultType(difference.m_BaseResultType)};
+            const bool bNewFailed{IsFailureResultType(difference.m_NewResultType)};
+            difference.m_Change = (bNewFailed && !bBaseFailed) ? BinaryResultChange::Regressed
+                : (!bNewFailed && bBaseFailed) ? BinaryResultChange::Fixed
+                : BinaryResultChange::Changed;
+            differences.push_back(std::move(difference));
+        }
+
+        for (const auto& [key, pTestRecord] : baseTests)
+        {
+            differences.push_back(BinaryResultDifference{
+                .m_Change = BinaryResultChange::Removed,
+                .m_TestKey = key,
+                .m_BaseResultType = pTestRecord->m_ResultType});
+        }
+
+        return differences;
+    }
+
+    // Collects the run in memory and writes the file once, when the run ends.
+    class BinaryResultsReporter final : public Reporter
+    {
+    private:
+
+        Internal_::BufferedFileWriter m_FileWriter;
+        BinaryResultsWriter m_ResultsWriter;
+        std::unordered_map<std::string, std::uint32_t, Internal_::TransparentStringHash, std::equal_to<>> m_OpenSuiteIndices;
+        std::mutex m_WriterMutex;
+
+    public:
+
+        explicit BinaryResultsReporter(_In_ const std::filesystem::path& path) :
+            m_FileWriter{path}
+        { }
+
+        ~BinaryResultsReporter() noexcept override
+        {
+            m_ResultsWriter.AppendTo(m_FileWriter.GetBuffer());
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return !!m_FileWriter;
+        }
+
+        void OnSuiteBegin(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::uint64_t) override
+        {
+            const std::scoped_lock lock{m_WriterMutex};
+            m_OpenSuiteIndices.insert_or_assign(std::string{suiteNameSV}, m_ResultsWriter.AddSuite(suiteNameSV));
+        }
+
+        void OnTestEnd(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::string_view testNameSV,
+            _In_ const TestStage testStage,
+            _In_ const Result& result,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            const std::scoped_lock lock{m_WriterMutex};
+            const auto it{m_OpenSuiteIndices.find(suiteNameSV)};
+            const std::uint32_t suiteIndex{(it != m_OpenSuiteIndices.end()) ? it->second : m_ResultsWriter.AddSuite(suiteNameSV)};
+            m_ResultsWriter.AddTest(
+                suiteIndex,
+                testNameSV,
+                result.m_SourceLocation.file_name(),
+                result.m_SourceLocation.line(),
+                testStage,
+                result.m_ResultType,
+                (endNs > beginNs) ? (endNs - beginNs) : 0,
+                result.m_Info);
+        }
+
+        void OnSuiteEnd(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const ResultTypeCounts& resultTypeCounts,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            const std::scoped_lock lock{m_WriterMutex};
+            const auto it{m_OpenSuiteIndices.find(suiteNameSV)};
+            if (it == m_OpenSuiteIndices.end())
+            {
+                return;
+            }
+
+            BinarySuiteRecord& suiteRecord{m_ResultsWriter.GetSuite(it->second)};
+            suiteRecord.m_DurationNs = (endNs > beginNs) ? (endNs - beginNs) : 0;
+            suiteRecord.m_ResultTypeCounts = resultTypeCounts;
+            m_OpenSuiteIndices.erase(it);
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
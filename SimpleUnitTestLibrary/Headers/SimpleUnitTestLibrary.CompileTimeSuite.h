@@ -0,0 +1,167 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#include "SimpleUnitTestLibrary.StaticRegistry.h"
+#include "SimpleUnitTestLibrary.Test.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Internal_
+    {
+        // A string that can be a template argument (see StaticSuiteCheck), so the compiler prints it in its diagnostics.
+        template <std::size_t CapacityT>
+        struct FixedString
+        {
+            char m_Chars[CapacityT]{};
+            std::size_t m_Length{0};
+
+            // Truncates rather than fails: the first part of a report is plenty to find the failure.
+            constexpr void Append(_In_ const std::string_view sv) noexcept
+            {
+                for (const char c : sv)
+                {
+                    if (m_Length == (CapacityT - 1))
+                    {
+                        return;
+                    }
+
+                    m_Chars[m_Length++] = c;
+                }
+            }
+
+            constexpr void Append(_In_ std::uint64_t value) noexcept
+            {
+                char digits[20]{};
+                std::size_t digitCount{0};
+                do
+                {
+                    digits[digitCount++] = static_cast<char>('0' + (value % 10));
+                    value /= 10;
+                } while (value != 0);
+
+                while (digitCount != 0)
+                {
+                    Append(std::string_view{&digits[--digitCount], 1});
+                }
+            }
+
+            [[nodiscard]] constexpr std::string_view View() const noexcept
+            {
+                return std::string_view{m_Chars, m_Length};
+            }
+        };
+    }
+
+    // The outcome of running a static suite at compile time (see EvaluateStaticSuite), e.g.,
+    //   {false, 3, 1, "MathSuite/AddTest: TestFailure: Add(1, 1) == 3 (Math.cpp:12)"}
+    struct StaticSuiteReport
+    {
+        bool m_bPassed{true};
+        std::uint32_t m_TestCount{0};
+        std::uint32_t m_FailureCount{0}; // Failed tests (all of them, after a failed setup), plus a failed cleanup.
+
+        // "<Suite>[/<Test>]: <ResultType>: <info> (<file>:<line>)", for the first failing stage.
+        Internal_::FixedString<512> m_FirstFailure;
+    };
+
+    namespace Internal_
+    {
+        constexpr void RecordStaticFailure(
+            _Inout_ StaticSuiteReport& report,
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::string_view testNameSV,
+            _In_ const Result& result)
+        {
+            ++report.m_FailureCount;
+            if (!report.m_bPassed)
+            {
+                return;
+            }
+
+            report.m_bPassed = false;
+
+            FixedString<512>& message{report.m_FirstFailure};
+            message.Append(suiteNameSV);
+            if (!testNameSV.empty())
+            {
+                message.Append("/");
+                message.Append(testNameSV);
+            }
+
+            message.Append(": ");
+            message.Append(ResultTypeToString(result.m_ResultType));
+            if (!result.m_Info.empty())
+            {
+                message.Append(": ");
+                message.Append(result.m_Info);
+            }
+
+            message.Append(" (");
+            message.Append(result.m_SourceLocation.file_name());
+            message.Append(":");
+            message.Append(std::uint64_t{result.m_SourceLocation.line()});
+            message.Append(")");
+        }
+
+        // Instantiating this with a failed report fails the static_assert below, and the compiler names the instantiation,
+        // report included, in its diagnostic. cbChecked is always true, so SUTL_STATIC_SUITE doesn't report it twice.
+        template <StaticSuiteReport ReportT>
+        struct StaticSuiteCheck
+        {
+            static_assert(ReportT.m_bPassed, "SUTL static suite failed; its StaticSuiteReport (template argument above) names the first failure.");
+
+            static constexpr bool cbChecked{true};
+        };
+    }
+
+    // Runs a suite's setup, tests, and cleanup during constant evaluation, as Suite would (tests don't run after a failed
+    // setup), without building a Suite: only the tests themselves need to be constexpr.
+    // A test that can't be constant-evaluated (e.g., it does I/O) is a compile error in its own right, at the offending call.
+    [[nodiscard]] consteval StaticSuiteReport EvaluateStaticSuite(_In_ const StaticSuiteDescriptor& staticSuiteDescriptor)
+    {
+        StaticSuiteReport report;
+        report.m_TestCount = static_cast<std::uint32_t>(staticSuiteDescriptor.m_TestDescriptors.size());
+
+        if (staticSuiteDescriptor.m_SuiteSetupFn)
+        {
+            const Result setupResult{staticSuiteDescriptor.m_SuiteSetupFn()};
+            if (!setupResult)
+            {
+                Internal_::RecordStaticFailure(report, staticSuiteDescriptor.m_SuiteNameSV, {}, setupResult);
+                report.m_FailureCount = report.m_TestCount;
+                return report;
+            }
+        }
+
+        for (const StaticTestDescriptor& testDescriptor : staticSuiteDescriptor.m_TestDescriptors)
+        {
+            const Result testResult{testDescriptor.m_TestFn()};
+            if (!testResult)
+            {
+                Internal_::RecordStaticFailure(report, staticSuiteDescriptor.m_SuiteNameSV, testDescriptor.m_TestNameSV, testResult);
+            }
+        }
+
+        if (staticSuiteDescriptor.m_SuiteCleanupFn)
+        {
+            const Result cleanupResult{staticSuiteDescriptor.m_SuiteCleanupFn()};
+            if (!cleanupResult)
+            {
+                Internal_::RecordStaticFailure(report, staticSuiteDescriptor.m_SuiteNameSV, {}, cleanupResult);
+            }
+        }
+
+        return report;
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,440 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <limits>
+#include <regex>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // What actually happened to the child process running a death test statement.
+    struct DeathTestOutcome
+    {
+        enum class Termination : std::uint8_t
+        {
+            // The statement completed normally - i.e., it did not die.
+            Returned,
+
+            // The statement let an exception escape.
+            ThrewException,
+
+            Exited,
+            Signaled,
+
+            // The child outlived its timeout (e.g., deadlocked on a lock another thread held when it was forked), and was killed.
+            TimedOut
+        };
+
+        Termination m_Termination{Termination::Returned};
+        int m_ExitCode{0};
+        int m_Signal{0};
+        std::string m_StderrOutput;
+
+        [[nodiscard]] std::string ToString() const
+        {
+            switch (m_Termination)
+            {
+            case Termination::Returned:
+                return "returned without dying";
+
+            case Termination::ThrewException:
+                return "threw an exception";
+
+            case Termination::Exited:
+                return std::format("exited with code {}", m_ExitCode);
+
+            case Termination::Signaled:
+#if defined(__unix__) || defined(__APPLE__)
+                return std::format("was killed by signal {} ({})", m_Signal, ::strsignal(m_Signal));
+#else
+                return std::format("was killed by signal {}", m_Signal);
+#endif
+
+            case Termination::TimedOut:
+                return "timed out, and was killed";
+            }
+
+            return "terminated in an unknown way";
+        }
+    };
+
+    namespace Concepts
+    {
+        template <typename PredicateT>
+        concept DeathTestPredicate = std::predicate<const PredicateT&, const DeathTestOutcome&>;
+    }
+
+    // Matches a process that was killed by a signal, or exited with a non-zero code.
+    struct DiedAbnormally
+    {
+        [[nodiscard]] constexpr bool operator()(_In_ const DeathTestOutcome& outcome) const noexcept
+        {
+            return (outcome.m_Termination == DeathTestOutcome::Termination::Signaled)
+                || ((outcome.m_Termination == DeathTestOutcome::Termination::Exited) && (outcome.m_ExitCode != 0));
+        }
+
+        [[nodiscard]] std::string Describe() const
+        {
+            return "die abnormally";
+        }
+    };
+
+    struct ExitedWithCode
+    {
+        int m_ExitCode;
+
+        [[nodiscard]] constexpr bool operator()(_In_ const DeathTestOutcome& outcome) const noexcept
+        {
+            return (outcome.m_Termination == DeathTestOutcome::Termination::Exited) && (outcome.m_ExitCode == m_ExitCode);
+        }
+
+        [[nodiscard]] std::string Describe() const
+        {
+            return std::format("exit with code {}", m_ExitCode);
+        }
+    };
+
+    struct KilledBySignal
+    {
+        int m_Signal;
+
+        [[nodiscard]] constexpr bool operator()(_In_ const DeathTestOutcome& outcome) const noexcept
+        {
+            return (outcome.m_Termination == DeathTestOutcome::Termination::Signaled) && (outcome.m_Signal == m_Signal);
+        }
+
+        [[nodiscard]] std::string Describe() const
+        {
+            return std::format("be killed by signal {}", m_Signal);
+        }
+    };
+
+    namespace Internal_
+    {
+        inline constexpr std::chrono::milliseconds g_cDefaultDeathTestTimeout{std::chrono::seconds{30}};
+
+#if defined(__unix__) || defined(__APPLE__)
+        // Close-on-exec, so a process another thread spawns meanwhile can't hold the write ends open (and the read
+        // loop waiting for EOF with them).
+        [[nodiscard]] inline bool MakeCloseOnExecPipe(_Out_ std::array<int, 2>& pipeFds) noexcept
+        {
+#if defined(__APPLE__)
+            if (::pipe(pipeFds.data()) != 0)
+            {
+                return false;
+            }
+
+            for (const int fd : pipeFds)
+            {
+                (void)::fcntl(fd, F_SETFD, FD_CLOEXEC);
+            }
+
+            return true;
+#else
+            return ::pipe2(pipeFds.data(), O_CLOEXEC) == 0;
+#endif
+        }
+
+        // Runs statement in a forked child with stderr captured through a pipe.
+        // The child is never exec'd (the statement runs in the copied address space, which is why vfork/posix_spawn
+        // can't be used), and core dumps are disabled in it, so an expected abort costs roughly one fork + one wait.
+        // Only the forking thread exists in the child, so a statement that needs a lock some other thread held at the
+        // time of the fork (e.g., one of the program's own threads) never gets it: after timeout, the child is killed.
+        template <std::invocable StatementT>
+        [[nodiscard]] bool RunInDeathTestChild(
+            _Inout_ StatementT& statement,
+            _In_ const std::chrono::milliseconds timeout,
+            _Out_ DeathTestOutcome& outcome,
+            _Out_ std::string& error)
+        {
+            std::array<int, 2> stderrPipe{-1, -1};
+            std::array<int, 2> statusPipe{-1, -1};
+            auto ClosePipe = [](_Inout_ std::array<int, 2>& pipeFds) static noexcept
+            {
+                for (int& fd : pipeFds)
+                {
+                    if (fd >= 0)
+                    {
+                        ::close(fd);
+                        fd = -1;
+                    }
+                }
+            };
+
+            if (!MakeCloseOnExecPipe(stderrPipe) || !MakeCloseOnExecPipe(statusPipe))
+            {
+                error = std::format("pipe() failed: {}", std::strerror(errno));
+                ClosePipe(stderrPipe);
+                ClosePipe(statusPipe);
+                return false;
+            }
+
+            // Don't let buffered output be written twice (once by each process). The library's own threads are kept
+            // from holding any lock the child may need (see ForkGate) until fork() returns.
+            const pid_t pid{[]()
+            {
+                const ForkGateForkScope forkScope;
+                std::fflush(nullptr);
+                return ::fork();
+            }()};
+            if (pid < 0)
+            {
+                error = std::format("fork() failed: {}", std::strerror(errno));
+                ClosePipe(stderrPipe);
+                ClosePipe(statusPipe);
+                return false;
+            }
+
+            if (pid == 0)
+            {
+                ::close(stderrPipe[0]);
+                ::close(statusPipe[0]);
+                ::dup2(stderrPipe[1], STDERR_FILENO);
+                ::close(stderrPipe[1]);
+
+                const struct rlimit noCoreDump{0, 0};
+                ::setrlimit(RLIMIT_CORE, &noCoreDump);
+
+                char status{'R'};
+                try
+                {
+                    std::invoke(statement);
+                }
+                catch (...)
+                {
+                    status = 'E';
+                }
+
+                (void)!::write(statusPipe[1], &status, 1);
+                ::_exit(0);
+            }
+
+            ::close(stderrPipe[1]);
+            ::close(statusPipe[1]);
+
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point deadline{Clock::now() + timeout};
+            auto GetRemainingMs = [deadline]() -> int
+            {
+                const auto remaining{std::chrono::ceil<std::chrono::milliseconds>(deadline - Clock::now())};
+                return static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(remaining.count(), 0, std::numeric_limits<int>::max()));
+            };
+
+            // Read stderr until the child closes it (normally, by exiting) or the deadline passes.
+            bool bTimedOut{false};
+            std::array<char, 4096> buffer;
+            for (;;)
+            {
+                struct pollfd stderrPollFd{stderrPipe[0], POLLIN, 0};
+                const int readyCount{::poll(&stderrPollFd, 1, GetRemainingMs())};
+                if (readyCount < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    break;
+                }
+
+                if (readyCount == 0)
+                {
+                    bTimedOut = true;
+                    break;
+                }
+
+                const auto bytesRead{::read(stderrPipe[0], buffer.data(), buffer.size())};
+                if (bytesRead > 0)
+                {
+                    outcome.m_StderrOutput.append(buffer.data(), static_cast<std::size_t>(bytesRead));
+                }
+                else if ((bytesRead == 0) || (errno != EINTR))
+                {
+                    break;
+                }
+            }
+
+            // The child may still be running (having closed stderr itself), so keep to the deadline while reaping it.
+            int waitStatus{0};
+            for (;;)
+            {
+                if (bTimedOut)
+                {
+                    ::kill(pid, SIGKILL);
+                }
+
+                const pid_t waitedPid{::waitpid(pid, &waitStatus, bTimedOut ? 0 : WNOHANG)};
+                if (waitedPid == pid)
+                {
+                    break;
+                }
+
+                if (waitedPid < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    error = std::format("waitpid() failed: {}", std::strerror(errno));
+                    ::close(stderrPipe[0]);
+                    ::close(statusPipe[0]);
+                    return false;
+                }
+
+                if (GetRemainingMs() == 0)
+                {
+                    bTimedOut = true;
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                }
+            }
+
+            if (bTimedOut && WIFSIGNALED(waitStatus) && (WTERMSIG(waitStatus) == SIGKILL))
+            {
+                ::close(stderrPipe[0]);
+                ::close(statusPipe[0]);
+                outcome.m_Termination = DeathTestOutcome::Termination::TimedOut;
+                return true;
+            }
+
+            char status{'\0'};
+            const bool bStatusWritten{::read(statusPipe[0], &status, 1) == 1};
+            ::close(stderrPipe[0]);
+            ::close(statusPipe[0]);
+
+            if (bStatusWritten)
+            {
+                outcome.m_Termination = (status == 'E')
+                    ? DeathTestOutcome::Termination::ThrewException
+                    : DeathTestOutcome::Termination::Returned;
+            }
+            else if (WIFSIGNALED(waitStatus))
+            {
+                outcome.m_Termination = DeathTestOutcome::Termination::Signaled;
+                outcome.m_Signal = WTERMSIG(waitStatus);
+            }
+            else
+            {
+                outcome.m_Termination = DeathTestOutcome::Termination::Exited;
+                outcome.m_ExitCode = WEXITSTATUS(waitStatus);
+            }
+
+            return true;
+        }
+#endif
+
+        template <typename PredicateT>
+        [[nodiscard]] std::string DescribeDeathTestPredicate(_In_ const PredicateT& predicate)
+        {
+            if constexpr (requires { { predicate.Describe() } -> std::convertible_to<std::string>; })
+            {
+                return predicate.Describe();
+            }
+            else
+            {
+                return "satisfy the death test predicate";
+            }
+        }
+    }
+
+    // Runs statement in a child process, and succeeds if the child's fate satisfies predicate and its
+    // stderr output contains a match for stderrRegexSV (ECMAScript, searched; empty matches anything).
+    // A child still running after timeout is killed, and the test fails (whatever the predicate).
+    // The Result's info always records what actually happened to the child.
+    template <std::invocable StatementT, Concepts::DeathTestPredicate PredicateT>
+    [[nodiscard]] Result RunDeathTest(
+        _Inout_ StatementT&& statement,
+        _In_ const PredicateT& predicate,
+        _In_ const std::string_view stderrRegexSV,
+        _In_ const std::string_view statementSV,
+        _In_ const std::chrono::milliseconds timeout = Internal_::g_cDefaultDeathTestTimeout,
+        _In_ const std::source_location srcLoc = std::source_location::current())
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        std::regex stderrRegex;
+        try
+        {
+            stderrRegex = std::regex{stderrRegexSV.cbegin(), stderrRegexSV.cend()};
+        }
+        catch (const std::regex_error& e)
+        {
+            return Result{ResultType::TestFailure, srcLoc, std::format("Invalid death test regex \"{}\": {}", stderrRegexSV, e.what())};
+        }
+
+        DeathTestOutcome outcome;
+        if (std::string error; !Internal_::RunInDeathTestChild(statement, timeout, outcome, error))
+        {
+            return Result{ResultType::TestFailure, srcLoc, std::format("Unable to run death test \"{}\": {}", statementSV, error)};
+        }
+
+        constexpr std::size_t cMaxReportedStderrLength{512};
+        const std::string_view reportedStderrSV{std::string_view{outcome.m_StderrOutput}.substr(0, cMaxReportedStderrLength)};
+        if (outcome.m_Termination == DeathTestOutcome::Termination::TimedOut)
+        {
+            return Result{
+                ResultType::TestFailure,
+                srcLoc,
+                std::format("Death test \"{}\" {} after {} ms; stderr: \"{}\"", statementSV, outcome.ToString(), timeout.count(), reportedStderrSV)};
+        }
+        if (!std::invoke(predicate, outcome))
+        {
+            return Result{
+                ResultType::TestFailure,
+                srcLoc,
+                std::format("Death test \"{}\" {} (expected to {}); stderr: \"{}\"",
+                    statementSV, outcome.ToString(), Internal_::DescribeDeathTestPredicate(predicate), reportedStderrSV)};
+        }
+
+        if (!std::regex_search(outcome.m_StderrOutput, stderrRegex))
+        {
+            return Result{
+                ResultType::TestFailure,
+                srcLoc,
+                std::format("Death test \"{}\" {}, but stderr did not match \"{}\"; stderr: \"{}\"",
+                    statementSV, outcome.ToString(), stderrRegexSV, reportedStderrSV)};
+        }
+
+        return Result{ResultType::Success, srcLoc, std::format("Death test \"{}\" {}", statementSV, outcome.ToString())};
+#else
+        (void)statement;
+        (void)predicate;
+        (void)stderrRegexSV;
+        (void)timeout;
+        return Result{
+            ResultType::Skipped,
+            srcLoc,
+            std::format("Death test \"{}\" not run: death tests require fork(), which this platform lacks", statementSV)};
+#endif
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
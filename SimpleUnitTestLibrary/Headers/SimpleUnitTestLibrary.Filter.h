@@ -0,0 +1,394 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <regex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Tags.h"
+#include "SimpleUnitTestLibrary.Utils.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Internal_
+    {
+        // Case-insensitive glob: '*' matches any run of characters, '?' any single character.
+        // Compiled once into the literal segments between '*'s; matching then anchors the first/last segment
+        // and finds each middle segment leftmost-first, which is linear in practice and never backtracks.
+        class [[nodiscard]] GlobPattern
+        {
+        private:
+
+            std::vector<std::string> m_Segments; // Lowercased; '?' is kept as a single-character wildcard.
+            bool m_bAnchoredBegin{false};
+            bool m_bAnchoredEnd{false};
+
+            [[nodiscard]] static constexpr bool SegmentMatchesAt(
+                _In_ const std::string_view segmentSV,
+                _In_ const std::string_view textSV,
+                _In_ const std::size_t offset) noexcept
+            {
+                for (std::size_t i = 0; i < segmentSV.size(); ++i)
+                {
+                    if ((segmentSV[i] != '?') && (segmentSV[i] != Utils::ToLowerAscii(textSV[offset + i])))
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+        public:
+
+            constexpr explicit GlobPattern(_In_ const std::string_view patternSV) :
+                m_bAnchoredBegin{!patternSV.starts_with('*')},
+                m_bAnchoredEnd{!patternSV.ends_with('*')}
+            {
+                std::size_t begin{0};
+                while (begin <= patternSV.size())
+                {
+                    const std::size_t end{std::min(patternSV.find('*', begin), patternSV.size())};
+                    if (end > begin)
+                    {
+                        std::string& segment{m_Segments.emplace_back(patternSV.substr(begin, end - begin))};
+                        for (char& c : segment)
+                        {
+                            c = Utils::ToLowerAscii(c);
+                        }
+                    }
+                    begin = end + 1;
+                }
+            }
+
+            [[nodiscard]] constexpr bool MatchesEverything() const noexcept
+            {
+                return m_Segments.empty() && !(m_bAnchoredBegin && m_bAnchoredEnd);
+            }
+
+            [[nodiscard]] constexpr bool operator()(_In_ const std::string_view textSV) const noexcept
+            {
+                if (m_Segments.empty())
+                {
+                    // "" only matches "", while "*" (or "**", ...) matches everything.
+                    return !(m_bAnchoredBegin && m_bAnchoredEnd) || textSV.empty();
+                }
+
+                std::size_t firstSegment{0};
+                std::size_t lastSegment{m_Segments.size()};
+                std::size_t pos{0};
+                std::size_t endLimit{textSV.size()};
+
+                if (m_bAnchoredBegin)
+                {
+                    const std::string& segment{m_Segments.front()};
+                    if ((segment.size() > textSV.size()) || !SegmentMatchesAt(segment, textSV, 0))
+                    {
+                        return false;
+                    }
+
+                    if ((m_Segments.size() == 1) && m_bAnchoredEnd)
+                    {
+                        return segment.size() == textSV.size();
+                    }
+
+                    pos = segment.size();
+                    ++firstSegment;
+                }
+
+                if (m_bAnchoredEnd && (lastSegment > firstSegment))
+                {
+                    const std::string& segment{m_Segments.back()};
+                    if ((segment.size() > (endLimit - pos)) || !SegmentMatchesAt(segment, textSV, endLimit - segment.size()))
+                    {
+                        return false;
+                    }
+
+                    endLimit -= segment.size();
+                    --lastSegment;
+                }
+
+                for (std::size_t i = firstSegment; i < lastSegment; ++i)
+                {
+                    const std::string& segment{m_Segments[i]};
+                    for (;;)
+                    {
+                        if (segment.size() > (endLimit - pos))
+                        {
+                            return false;
+                        }
+
+                        if (SegmentMatchesAt(segment, textSV, pos))
+                        {
+                            pos += segment.size();
+                            break;
+                        }
+
+                        ++pos;
+                    }
+                }
+
+                return true;
+            }
+        };
+    }
+
+    // Whether Runner should skip a suite, run all of it, or ask TestFilter::IsTestSelected about each of its tests.
+    enum class FilterSelection : std::uint8_t
+    {
+        None,
+        All,
+        PerTest
+    };
+
+    // Selects tests by their full name ("Suite/Test"), compiled once from one or more filter expressions.
+    //
+    // An expression is a comma-separated list of terms; terms starting with '-' exclude, all others include.
+    // A test is selected if it matches any include term (or there are none), and no exclude term.
+    //   Suite*          Glob ('*', '?') over the suite name; all of the matched suites' tests.
+    //   Suite*/Test*    Glob over the suite name, and glob over the test name.
+    //   name            Without wildcards, a pattern matches as a substring (so "math" selects "BigMathSuite").
+    //   re:<regex>      ECMAScript regex searched for in "Suite/Test"; runs to the end of its expression, so
+    //                   it can contain commas. Slower than globs, since it can't be decided per suite.
+    //   [tag]           Tests carrying the tag (see Tags.h), e.g., "[integration]", or "-[slow]" to leave slow tests out.
+    // Matching is case-insensitive.
+    class [[nodiscard]] TestFilter
+    {
+    private:
+
+        struct Term
+        {
+            bool m_bExclude{false};
+            Internal_::GlobPattern m_SuitePattern{"*"};
+            Internal_::GlobPattern m_TestPattern{"*"};
+            std::optional<std::regex> m_Regex;
+            std::optional<Tag> m_Tag;
+            bool m_bInvalid{false}; // E.g., a regex that didn't compile, or an unknown tag; matches nothing.
+
+            // Glob terms can be decided from the suite name; regex and tag terms need each test.
+            [[nodiscard]] bool IsGlob() const noexcept
+            {
+                return !m_Regex && !m_Tag;
+            }
+        };
+
+        std::vector<Term> m_Terms;
+        bool m_bHasIncludes{false};
+        std::vector<std::string> m_ErrorMessages;
+
+        [[nodiscard]] static std::string MakeGlob(_In_ const std::string_view patternSV)
+        {
+            return (patternSV.find_first_of("*?") == std::string_view::npos) ? std::format("*{}*", patternSV) : std::string{patternSV};
+        }
+
+        void AddExpression(_In_ std::string_view expressionSV)
+        {
+            using namespace std::string_view_literals;
+
+            while (!expressionSV.empty())
+            {
+                const std::size_t leadingSpaces{std::min(expressionSV.find_first_not_of(' '), expressionSV.size())};
+                expressionSV.remove_prefix(leadingSpaces);
+
+                Term term;
+                term.m_bExclude = expressionSV.starts_with('-');
+                if (term.m_bExclude)
+                {
+                    expressionSV.remove_prefix(1);
+                }
+
+                if (expressionSV.starts_with("re:"sv))
+                {
+                    const std::string_view regexSV{expressionSV.substr("re:"sv.size())};
+                    try
+                    {
+                        term.m_Regex.emplace(regexSV.cbegin(), regexSV.cend(), std::regex::ECMAScript | std::regex::icase | std::regex::optimize);
+                    }
+                    catch (const std::regex_error& error)
+                    {
+                        term.m_bInvalid = true;
+                        m_ErrorMessages.push_back(std::format("Invalid filter regex \"{}\" ({}); it matches nothing.", regexSV, error.what()));
+                    }
+                    expressionSV = {};
+                }
+                else
+                {
+                    const std::size_t termEnd{std::min(expressionSV.find(','), expressionSV.size())};
+                    std::string_view patternSV{expressionSV.substr(0, termEnd)};
+                    expressionSV.remove_prefix(std::min(termEnd + 1, expressionSV.size()));
+
+                    patternSV = patternSV.substr(0, patternSV.find_last_not_of(' ') + 1);
+                    if (patternSV.empty())
+                    {
+                        continue;
+                    }
+
+                    if (patternSV.starts_with('[') && patternSV.ends_with(']'))
+                    {
+                        const std::string_view tagNameSV{patternSV.substr(1, patternSV.size() - 2)};
+                        term.m_Tag = FindTag(tagNameSV);
+                        if (!term.m_Tag)
+                        {
+                            term.m_bInvalid = true;
+                            m_ErrorMessages.push_back(std::format("Unknown filter tag \"{}\"; it matches nothing.", tagNameSV));
+                        }
+                    }
+                    else if (const std::size_t slash{patternSV.find('/')}; slash != std::string_view::npos)
+                    {
+                        term.m_SuitePattern = Internal_::GlobPattern{MakeGlob(patternSV.substr(0, slash))};
+                        term.m_TestPattern = Internal_::GlobPattern{MakeGlob(patternSV.substr(slash + 1))};
+                    }
+                    else
+                    {
+                        term.m_SuitePattern = Internal_::GlobPattern{MakeGlob(patternSV)};
+                    }
+                }
+
+                m_bHasIncludes = m_bHasIncludes || !term.m_bExclude;
+                m_Terms.push_back(std::move(term));
+            }
+        }
+
+        [[nodiscard]] static bool TermMatchesTest(
+            _In_ const Term& term,
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::string_view testNameSV,
+            _In_ const TestTags testTags,
+            _Inout_ std::string& fullNameBuffer)
+        {
+            if (term.m_bInvalid)
+            {
+                return false;
+            }
+
+            if (term.m_Tag)
+            {
+                return testTags.Contains(*term.m_Tag);
+            }
+
+            if (term.m_Regex)
+            {
+                fullNameBuffer.assign(suiteNameSV);
+                fullNameBuffer += '/';
+                fullNameBuffer += testNameSV;
+                return std::regex_search(fullNameBuffer, *term.m_Regex);
+            }
+
+            return term.m_SuitePattern(suiteNameSV) && term.m_TestPattern(testNameSV);
+        }
+
+    public:
+
+        // Selects everything.
+        TestFilter() = default;
+
+        explicit TestFilter(_In_ const std::span<const std::string_view> expressionSVs)
+        {
+            for (const std::string_view expressionSV : expressionSVs)
+            {
+                AddExpression(expressionSV);
+            }
+        }
+
+        [[nodiscard]] bool SelectsEverything() const noexcept
+        {
+            return m_Terms.empty();
+        }
+
+        // One per term that couldn't be compiled.
+        [[nodiscard]] std::span<const std::string> GetErrorMessages() const noexcept
+        {
+            return m_ErrorMessages;
+        }
+
+        // Decided from the suite name alone wherever possible, so most suites never need per-test matching.
+        [[nodiscard]] FilterSelection SelectSuite(_In_ const std::string_view suiteNameSV) const
+        {
+            bool bIncludesAll{!m_bHasIncludes};
+            bool bIncludesSome{false};
+            bool bExcludesSome{false};
+            for (const Term& term : m_Terms)
+            {
+                if (term.m_bInvalid)
+                {
+                    continue;
+                }
+
+                if (term.IsGlob() && !term.m_SuitePattern(suiteNameSV))
+                {
+                    continue;
+                }
+
+                const bool bWholeSuite{term.IsGlob() && term.m_TestPattern.MatchesEverything()};
+                if (term.m_bExclude)
+                {
+                    if (bWholeSuite)
+                    {
+                        return FilterSelection::None;
+                    }
+
+                    bExcludesSome = true;
+                }
+                else
+                {
+                    bIncludesAll = bIncludesAll || bWholeSuite;
+                    bIncludesSome = true;
+                }
+            }
+
+            if (!bIncludesAll && !bIncludesSome)
+            {
+                return FilterSelection::None;
+            }
+
+            return (bIncludesAll && !bExcludesSome) ? FilterSelection::All : FilterSelection::PerTest;
+        }
+
+        [[nodiscard]] bool IsTestSelected(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::string_view testNameSV,
+            _In_ const TestTags testTags = {}) const
+        {
+            std::string fullNameBuffer;
+            bool bIncluded{!m_bHasIncludes};
+            for (const Term& term : m_Terms)
+            {
+                if ((term.m_bExclude || !bIncluded) && TermMatchesTest(term, suiteNameSV, testNameSV, testTags, fullNameBuffer))
+                {
+                    if (term.m_bExclude)
+                    {
+                        return false;
+                    }
+
+                    bIncluded = true;
+                }
+            }
+
+            return bIncluded;
+        }
+    };
+
+    namespace Internal_
+    {
+        // Set by Runner for the duration of a run when filtering below suite granularity may be needed.
+        inline constinit std::atomic<const TestFilter*> g_pActiveTestFilter{nullptr};
+
+        [[nodiscard]] inline const TestFilter* GetActiveTestFilter() noexcept
+        {
+            return g_pActiveTestFilter.load(std::memory_order_acquire);
+        }
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,335 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <format>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#include "SimpleUnitTestLibrary.Tags.h"
+#include "SimpleUnitTestLibrary.Test.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Concepts
+    {
+        // A fixture is built (default-constructed) for a test and destroyed after it; its constructor and destructor are
+        // the test's setup and cleanup. A constructor that throws fails the test with SetupFailure.
+        template <typename FixtureT>
+        concept Fixture = std::default_initializable<FixtureT> && std::destructible<FixtureT>;
+
+        // A pooled fixture with Reset() is reset after each test, and only reused if Reset() returns true.
+        template <typename FixtureT>
+        concept ResettableFixture = Fixture<FixtureT> && requires (FixtureT& fixture)
+        {
+            { fixture.Reset() } -> std::same_as<bool>;
+        };
+    }
+
+    template <Concepts::Fixture FixtureT>
+    using FixtureTestFunction = Result(*)(FixtureT&);
+
+    // A test run against its own FixtureT (or one from a FixturePool), e.g., SUTL_CREATE_FIXTURE_TEST(QueryTest).
+    template <Concepts::Fixture FixtureT>
+    struct FixtureTest
+    {
+        std::string m_TestName;
+        FixtureTestFunction<FixtureT> m_TestFn{};
+        TestTags m_Tags{};
+        std::source_location m_SourceLocation{std::source_location::current()};
+    };
+
+    template <typename FixtureT, typename... ArgTs>
+    FixtureTest(std::string, Result(*)(FixtureT&), ArgTs...) -> FixtureTest<FixtureT>;
+
+    // Keeps fixtures between tests, so expensive ones (a loaded data set, a started server, ...) are built once per thread
+    // rather than once per test. A fixture is only ever reused on the thread that built it, so it needn't be thread-safe,
+    // and tests spread over several threads (see MakeFixtureTests) don't share state.
+    // Share one pool (it's held by shared_ptr) between suites to reuse fixtures across all of them.
+    template <Concepts::Fixture FixtureT>
+    class FixturePool
+    {
+    private:
+
+        const std::size_t m_MaxIdlePerThread;
+
+        std::mutex m_Mutex;
+        std::map<std::thread::id, std::vector<std::unique_ptr<FixtureT>>> m_IdleFixtures;
+
+        std::atomic<std::uint64_t> m_ConstructedCount{0};
+
+    public:
+
+        // maxIdlePerThread bounds how many fixtures each thread keeps (one per test it runs at a time is all it reuses).
+        explicit FixturePool(_In_ const std::size_t maxIdlePerThread = 1) :
+            m_MaxIdlePerThread{std::max(maxIdlePerThread, std::size_t{1})}
+        { }
+
+        FixturePool(const FixturePool&) = delete;
+        FixturePool& operator=(const FixturePool&) = delete;
+
+        // A fixture this thread used before, or a new one. Throws whatever FixtureT's constructor throws.
+        [[nodiscard]] std::unique_ptr<FixtureT> Acquire()
+        {
+            {
+                const std::lock_guard lock{m_Mutex};
+                std::vector<std::unique_ptr<FixtureT>>& idleFixtures{m_IdleFixtures[std::this_thread::get_id()]};
+                if (!idleFixtures.empty())
+                {
+                    std::unique_ptr<FixtureT> pFixture{std::move(idleFixtures.back())};
+                    idleFixtures.pop_back();
+                    return pFixture;
+                }
+
+                // Room to take it back, so Release never allocates (it runs inside the test's allocation tracking).
+                idleFixtures.reserve(m_MaxIdlePerThread);
+            }
+
+            auto pFixture{std::make_unique<FixtureT>()};
+            m_ConstructedCount.fetch_add(1, std::memory_order_relaxed);
+            return pFixture;
+        }
+
+        // Resets the fixture (see Concepts::ResettableFixture) and keeps it for this thread's next test, if there's room.
+        void Release(_Inout_ std::unique_ptr<FixtureT> pFixture)
+        {
+            if constexpr (Concepts::ResettableFixture<FixtureT>)
+            {
+                if (!pFixture->Reset())
+                {
+                    return;
+                }
+            }
+
+            const std::lock_guard lock{m_Mutex};
+            std::vector<std::unique_ptr<FixtureT>>& idleFixtures{m_IdleFixtures[std::this_thread::get_id()]};
+            if (idleFixtures.size() < m_MaxIdlePerThread)
+            {
+                idleFixtures.push_back(std::move(pFixture));
+            }
+        }
+
+        // How many fixtures the pool has built, e.g., to check that they're being reused.
+        [[nodiscard]] std::uint64_t GetConstructedCount() const noexcept
+        {
+            return m_ConstructedCount.load(std::memory_order_relaxed);
+        }
+    };
+
+    // Runs each test against a fixture: a new FixtureT per test, or one from a FixturePool. Tests can be spread over
+    // threadCount worker threads, each with its own fixtures; tests tagged SerialOnly still run one at a time, afterwards,
+    // on the calling thread. Results are the same as a TestFunction's: each test is instrumented on the thread that runs
+    // it, from acquiring its fixture (construction included, when not pooled) to releasing it. So anything a test leaves
+    // in a pooled fixture (that Reset() doesn't free) is reported as a leak, like any other state kept between tests.
+    template <Concepts::Fixture FixtureT>
+    class FixtureTestGenerator final : public TestGenerator
+    {
+    private:
+
+        std::vector<FixtureTest<FixtureT>> m_Tests;
+        std::shared_ptr<FixturePool<FixtureT>> m_pFixturePool;
+        std::uint32_t m_ThreadCount;
+
+        [[nodiscard]] Result RunFixtureTest(_In_ const std::size_t testIndex) const
+        {
+            const FixtureTest<FixtureT>& test{m_Tests[testIndex]};
+            auto MakeSetupFailure = [&test](_In_ const std::string_view whatSV)
+            {
+                return Result{ResultType::SetupFailure, test.m_SourceLocation, std::format("Fixture construction threw: {}", whatSV)};
+            };
+
+            if (!m_pFixturePool)
+            {
+                return Internal_::InvokeInstrumentedTest(
+                    [&test, &MakeSetupFailure]()
+                    {
+                        std::optional<FixtureT> fixture;
+                        try
+                        {
+                            fixture.emplace();
+                        }
+                        catch (const std::exception& e)
+                        {
+                            return MakeSetupFailure(e.what());
+                        }
+                        catch (...)
+                        {
+                            return MakeSetupFailure("Unknown exception");
+                        }
+
+                        return test.m_TestFn(*fixture);
+                    });
+            }
+
+            // Building a fixture for the pool isn't part of the test: the pool keeps it.
+            std::unique_ptr<FixtureT> pFixture;
+            try
+            {
+                pFixture = m_pFixturePool->Acquire();
+            }
+            catch (const std::exception& e)
+            {
+                return MakeSetupFailure(e.what());
+            }
+            catch (...)
+            {
+                return MakeSetupFailure("Unknown exception");
+            }
+
+            return Internal_::InvokeInstrumentedTest(
+                [this, &test, &pFixture]()
+                {
+                    Result result{test.m_TestFn(*pFixture)};
+                    m_pFixturePool->Release(std::move(pFixture));
+                    return result;
+                });
+        }
+
+    public:
+
+        FixtureTestGenerator(
+            _Inout_ std::vector<FixtureTest<FixtureT>> tests,
+            _Inout_ std::shared_ptr<FixturePool<FixtureT>> pFixturePool,
+            _In_ const std::uint32_t threadCount) noexcept :
+            m_Tests{std::move(tests)},
+            m_pFixturePool{std::move(pFixturePool)},
+            m_ThreadCount{std::max(threadCount, std::uint32_t{1})}
+        { }
+
+        [[nodiscard]] std::size_t GetTestCount() const override
+        {
+            return m_Tests.size();
+        }
+
+        void FormatTestName(
+            _In_ const std::size_t testIndex,
+            _Inout_ std::string& testName) const override
+        {
+            testName = m_Tests[testIndex].m_TestName;
+        }
+
+        [[nodiscard]] TestTags GetTestTags(_In_ const std::size_t testIndex) const override
+        {
+            return m_Tests[testIndex].m_Tags;
+        }
+
+        [[nodiscard]] Result RunTest(_In_ const std::size_t testIndex) const override
+        {
+            return RunFixtureTest(testIndex);
+        }
+
+        void RunTests(
+            _In_ const std::span<const std::size_t> testIndices,
+            _Inout_ TestResultSink& resultSink) const override
+        {
+            std::vector<std::size_t> parallelTestIndices;
+            std::vector<std::size_t> serialTestIndices;
+            for (const std::size_t testIndex : testIndices)
+            {
+                const bool bSerial{(m_ThreadCount == 1) || m_Tests[testIndex].m_Tags.Contains(Tag::SerialOnly)};
+                (bSerial ? serialTestIndices : parallelTestIndices).push_back(testIndex);
+            }
+
+            if (!parallelTestIndices.empty())
+            {
+                // Workers post each test's begin and end here; the sink is only ever called on this thread.
+                std::mutex mutex;
+                std::condition_variable eventCondition;
+                std::deque<std::pair<std::size_t, std::optional<Result>>> events;
+                std::atomic<std::size_t> nextTest{0};
+
+                auto Post = [&mutex, &eventCondition, &events](_In_ const std::size_t testIndex, _Inout_ std::optional<Result>&& result)
+                {
+                    const std::lock_guard lock{mutex};
+                    events.emplace_back(testIndex, std::move(result));
+                    eventCondition.notify_one();
+                };
+
+                std::vector<std::jthread> workers;
+                const std::size_t workerCount{std::min<std::size_t>(m_ThreadCount, parallelTestIndices.size())};
+                workers.reserve(workerCount);
+                for (std::size_t i = 0; i < workerCount; ++i)
+                {
+                    workers.emplace_back(
+                        [this, &parallelTestIndices, &nextTest, &Post]()
+                        {
+                            for (std::size_t position = nextTest.fetch_add(1, std::memory_order_relaxed);
+                                position < parallelTestIndices.size();
+                                position = nextTest.fetch_add(1, std::memory_order_relaxed))
+                            {
+                                const std::size_t testIndex{parallelTestIndices[position]};
+                                const Internal_::ForkGateWorkScope forkGateWorkScope;
+                                Post(testIndex, std::nullopt);
+                                Post(testIndex, RunFixtureTest(testIndex));
+                            }
+                        });
+                }
+
+                std::size_t remainingCount{parallelTestIndices.size()};
+                std::deque<std::pair<std::size_t, std::optional<Result>>> postedEvents;
+                while (remainingCount != 0)
+                {
+                    {
+                        std::unique_lock lock{mutex};
+                        eventCondition.wait(lock, [&events]() { return !events.empty(); });
+                        postedEvents.swap(events);
+                    }
+
+                    for (auto& [testIndex, result] : postedEvents)
+                    {
+                        if (!result)
+                        {
+                            resultSink.OnTestBegin(testIndex);
+                            continue;
+                        }
+
+                        resultSink.OnTestEnd(testIndex, std::move(*result));
+                        --remainingCount;
+                    }
+                    postedEvents.clear();
+                }
+            }
+
+            for (const std::size_t testIndex : serialTestIndices)
+            {
+                resultSink.OnTestBegin(testIndex);
+                resultSink.OnTestEnd(testIndex, RunFixtureTest(testIndex));
+            }
+        }
+    };
+
+    // E.g., SUTL::MakeFixtureTests<DatabaseFixture>({SUTL_CREATE_FIXTURE_TEST(QueryTest), SUTL_CREATE_FIXTURE_TEST(InsertTest)},
+    //           std::make_shared<SUTL::FixturePool<DatabaseFixture>>(), 4)
+    // A null pool builds a fixture per test; threadCount spreads the tests over that many worker threads.
+    template <Concepts::Fixture FixtureT>
+    [[nodiscard]] std::unique_ptr<const TestGenerator> MakeFixtureTests(
+        _Inout_ std::vector<FixtureTest<FixtureT>> tests,
+        _Inout_ std::shared_ptr<FixturePool<FixtureT>> pFixturePool = nullptr,
+        _In_ const std::uint32_t threadCount = 1)
+    {
+        return std::make_unique<const FixtureTestGenerator<FixtureT>>(std::move(tests), std::move(pFixturePool), threadCount);
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,556 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+#if defined(__clang__)
+#define SUTL_NO_SANITIZE_COVERAGE_ __attribute__((no_sanitize("coverage")))
+#elif defined(__GNUC__)
+#define SUTL_NO_SANITIZE_COVERAGE_ __attribute__((no_sanitize_coverage))
+#else
+#define SUTL_NO_SANITIZE_COVERAGE_
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Internal_
+    {
+        // Edge hit counters, indexed by the guard ID assigned in __sanitizer_cov_trace_pc_guard_init
+        // (Clang's -fsanitize-coverage=trace-pc-guard), or by a hash of the caller's PC for GCC's
+        // -fsanitize-coverage=trace-pc; the callbacks are opt-in (see SimpleUnitTestLibrary.FuzzCoverageHooks.h).
+        // Without them, or without either flag, the counters simply stay zero and the fuzzer degrades to blind
+        // mutation of the corpus.
+        // Plain array (not std::array) so the callbacks never call into instrumented code.
+        inline constexpr std::size_t g_cFuzzEdgeCounterCount{std::size_t{1} << 16};
+        alignas(64) inline constinit std::uint8_t g_FuzzEdgeCounters[g_cFuzzEdgeCounterCount]{};
+        inline constinit std::uint32_t g_FuzzNextGuardId{1};
+
+        // State for the crash handler - only touched from async-signal-safe code.
+        inline constinit const std::byte* g_pFuzzCurrentInput{nullptr};
+        inline constinit std::size_t g_FuzzCurrentInputSize{0};
+        inline constinit std::array<char, 4096> g_FuzzCrashPathPrefix{};
+        inline constinit std::size_t g_FuzzCrashPathPrefixLength{0};
+
+        [[nodiscard]] constexpr std::uint64_t Fnv1a64(_In_ const std::span<const std::byte> bytes) noexcept
+        {
+            std::uint64_t hash{0xcbf29ce484222325ull};
+            for (const std::byte b : bytes)
+            {
+                hash ^= static_cast<std::uint8_t>(b);
+                hash *= 0x100000001b3ull;
+            }
+
+            return hash;
+        }
+
+        // libFuzzer-style hit count buckets, so a loop running 10 vs. 100 times is "new coverage".
+        [[nodiscard]] constexpr std::uint8_t FuzzHitCountToBucketMask(_In_ const std::uint8_t hitCount) noexcept
+        {
+            if (hitCount == 0) { return 0; }
+            if (hitCount == 1) { return 1 << 0; }
+            if (hitCount == 2) { return 1 << 1; }
+            if (hitCount == 3) { return 1 << 2; }
+            if (hitCount < 8) { return 1 << 3; }
+            if (hitCount < 16) { return 1 << 4; }
+            if (hitCount < 32) { return 1 << 5; }
+            if (hitCount < 128) { return 1 << 6; }
+            return 1 << 7;
+        }
+        static_assert(FuzzHitCountToBucketMask(0) == 0);
+        static_assert(FuzzHitCountToBucketMask(1) == 1);
+        static_assert(FuzzHitCountToBucketMask(5) == 8);
+        static_assert(FuzzHitCountToBucketMask(255) == 128);
+
+#if defined(__unix__) || defined(__APPLE__)
+        inline constexpr std::array g_cFuzzCrashSignals{SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT};
+
+        SUTL_NO_SANITIZE_COVERAGE_ inline void FuzzCrashSignalHandler(_In_ const int signal) noexcept
+        {
+            // Async-signal-safe only: hash, build the path by hand, open/write/close, then re-raise.
+            std::array<char, g_FuzzCrashPathPrefix.size() + 16 + 1> path{};
+            std::size_t length{0};
+            for (; length < g_FuzzCrashPathPrefixLength; ++length)
+            {
+                path[length] = g_FuzzCrashPathPrefix[length];
+            }
+
+            const std::span<const std::byte> input{g_pFuzzCurrentInput, g_FuzzCurrentInputSize};
+            const std::uint64_t hash{Fnv1a64(input)};
+            for (int shift = 60; shift >= 0; shift -= 4)
+            {
+                path[length++] = "0123456789abcdef"[(hash >> shift) & 0xF];
+            }
+            path[length] = '\0';
+
+            if (const int fd = ::open(path.data(), O_WRONLY | O_CREAT | O_TRUNC, 0644); fd >= 0)
+            {
+                (void)!::write(fd, input.data(), input.size());
+                ::close(fd);
+            }
+
+            constexpr std::string_view cMessageSV{"SUTL fuzzer: crashing input saved to "};
+            (void)!::write(STDERR_FILENO, cMessageSV.data(), cMessageSV.size());
+            (void)!::write(STDERR_FILENO, path.data(), length);
+            (void)!::write(STDERR_FILENO, "\n", 1);
+
+            std::signal(signal, SIG_DFL);
+            std::raise(signal);
+        }
+#endif
+    }
+}
+
+
+namespace SimpleUnitTestLibrary
+{
+    using FuzzTestFunction = Result(*)(std::span<const std::byte>);
+
+    struct FuzzOptions
+    {
+        // Inputs found to increase coverage are persisted here, and existing files seed the run.
+        // Leave empty for an in-memory corpus.
+        std::filesystem::path m_CorpusDirectory;
+
+        // Crashing and failing inputs are written here as "crash-<hash>" / "failure-<hash>".
+        std::filesystem::path m_ArtifactDirectory{"."};
+
+        // Tokens for dictionary insertion (e.g., keywords and magic numbers of the format under test).
+        std::vector<std::vector<std::byte>> m_Dictionary;
+
+        std::uint64_t m_MaxIterations{100'000};
+        std::chrono::milliseconds m_MaxDuration{0}; // Zero means bounded by m_MaxIterations only.
+        std::size_t m_MaxInputLength{4096};
+        std::uint64_t m_Seed{0}; // Zero means seed from std::random_device.
+    };
+
+    class FuzzMutator
+    {
+    private:
+
+        std::mt19937_64 m_Rng;
+        std::span<const std::vector<std::byte>> m_Dictionary;
+        std::size_t m_MaxInputLength;
+
+        [[nodiscard]] std::size_t RandomIndex(_In_ const std::size_t bound) noexcept
+        {
+            return (bound == 0) ? 0 : static_cast<std::size_t>(m_Rng() % bound);
+        }
+
+        void FlipBit(_Inout_ std::vector<std::byte>& data)
+        {
+            if (!data.empty())
+            {
+                data[RandomIndex(data.size())] ^= std::byte{static_cast<std::uint8_t>(1u << RandomIndex(8))};
+            }
+        }
+
+        void SetRandomByte(_Inout_ std::vector<std::byte>& data)
+        {
+            if (!data.empty())
+            {
+                data[RandomIndex(data.size())] = std::byte{static_cast<std::uint8_t>(m_Rng())};
+            }
+        }
+
+        void SetInterestingByte(_Inout_ std::vector<std::byte>& data)
+        {
+            static constexpr std::array<std::uint8_t, 8> s_cInterestingValues{0x00, 0x01, 0x7F, 0x80, 0xFF, 0x20, 0x0A, 0x30};
+            if (!data.empty())
+            {
+                data[RandomIndex(data.size())] = std::byte{s_cInterestingValues[RandomIndex(s_cInterestingValues.size())]};
+            }
+        }
+
+        void AddToByte(_Inout_ std::vector<std::byte>& data)
+        {
+            if (!data.empty())
+            {
+                auto& b{data[RandomIndex(data.size())]};
+                b = std::byte{static_cast<std::uint8_t>(static_cast<std::uint8_t>(b) + RandomIndex(35) - 17)};
+            }
+        }
+
+        void InsertRandomBytes(_Inout_ std::vector<std::byte>& data)
+        {
+            const std::size_t count{std::min(1 + RandomIndex(8), m_MaxInputLength - data.size())};
+            const auto pos{data.begin() + static_cast<std::ptrdiff_t>(RandomIndex(data.size() + 1))};
+            std::vector<std::byte> bytes(count);
+            std::ranges::generate(bytes, [this]() { return std::byte{static_cast<std::uint8_t>(m_Rng())}; });
+            data.insert(pos, bytes.cbegin(), bytes.cend());
+        }
+
+        void EraseBytes(_Inout_ std::vector<std::byte>& data)
+        {
+            if (!data.empty())
+            {
+                const std::size_t pos{RandomIndex(data.size())};
+                const std::size_t count{1 + RandomIndex(std::min<std::size_t>(data.size() - pos, 16))};
+                data.erase(data.begin() + static_cast<std::ptrdiff_t>(pos), data.begin() + static_cast<std::ptrdiff_t>(pos + count));
+            }
+        }
+
+        void DuplicateChunk(_Inout_ std::vector<std::byte>& data)
+        {
+            if (data.empty())
+            {
+                return;
+            }
+
+            const std::size_t pos{RandomIndex(data.size())};
+            const std::size_t count{std::min(1 + RandomIndex(data.size() - pos), m_MaxInputLength - data.size())};
+            const std::vector<std::byte> chunk(data.begin() + static_cast<std::ptrdiff_t>(pos), data.begin() + static_cast<std::ptrdiff_t>(pos + count));
+            data.insert(data.begin() + static_cast<std::ptrdiff_t>(RandomIndex(data.size() + 1)), chunk.cbegin(), chunk.cend());
+        }
+
+        void InsertDictionaryToken(_Inout_ std::vector<std::byte>& data)
+        {
+            if (m_Dictionary.empty())
+            {
+                return InsertRandomBytes(data);
+            }
+
+            const auto& token{m_Dictionary[RandomIndex(m_Dictionary.size())]};
+            const std::size_t pos{RandomIndex(data.size() + 1)};
+            if (((m_Rng() & 1) == 0) && (pos + token.size() <= data.size()))
+            {
+                // Overwrite in place.
+                std::ranges::copy(token, data.begin() + static_cast<std::ptrdiff_t>(pos));
+            }
+            else if (data.size() + token.size() <= m_MaxInputLength)
+            {
+                data.insert(data.begin() + static_cast<std::ptrdiff_t>(pos), token.cbegin(), token.cend());
+            }
+        }
+
+    public:
+
+        FuzzMutator(
+            _In_ const std::uint64_t seed,
+            _In_ const std::span<const std::vector<std::byte>> dictionary,
+            _In_ const std::size_t maxInputLength) :
+            m_Rng{seed},
+            m_Dictionary{dictionary},
+            m_MaxInputLength{std::max<std::size_t>(maxInputLength, 1)}
+        { }
+
+        // Splice: prefix of one corpus entry joined with the suffix of another.
+        [[nodiscard]] std::vector<std::byte> Splice(
+            _In_ const std::span<const std::byte> first,
+            _In_ const std::span<const std::byte> second)
+        {
+            const std::size_t firstCount{RandomIndex(first.size() + 1)};
+            const std::size_t secondPos{RandomIndex(second.size() + 1)};
+
+            std::vector<std::byte> data;
+            data.reserve(firstCount + (second.size() - secondPos));
+            data.append_range(first.first(firstCount));
+            data.append_range(second.subspan(secondPos));
+            if (data.size() > m_MaxInputLength)
+            {
+                data.resize(m_MaxInputLength);
+            }
+
+            return data;
+        }
+
+        // Applies a small stack of random mutations in place.
+        void Mutate(_Inout_ std::vector<std::byte>& data)
+        {
+            const std::size_t mutationCount{1 + RandomIndex(4)};
+            for (std::size_t i = 0; i < mutationCount; ++i)
+            {
+                switch (RandomIndex(8))
+                {
+                case 0: FlipBit(data); break;
+                case 1: SetRandomByte(data); break;
+                case 2: SetInterestingByte(data); break;
+                case 3: AddToByte(data); break;
+                case 4: InsertRandomBytes(data); break;
+                case 5: EraseBytes(data); break;
+                case 6: DuplicateChunk(data); break;
+                default: InsertDictionaryToken(data); break;
+                }
+            }
+
+            if (data.size() > m_MaxInputLength)
+            {
+                data.resize(m_MaxInputLength);
+            }
+        }
+    };
+
+    class [[nodiscard]] FuzzTarget
+    {
+    private:
+
+        std::string m_TargetName;
+        FuzzTestFunction m_FuzzFn;
+
+        mutable Result m_Result;
+
+        [[nodiscard]] static std::string HashToHex(_In_ const std::span<const std::byte> input)
+        {
+            return std::format("{:016x}", Internal_::Fnv1a64(input));
+        }
+
+        static void WriteInput(
+            _In_ const std::filesystem::path& path,
+            _In_ const std::span<const std::byte> input)
+        {
+            std::ofstream file{path, std::ios_base::binary | std::ios_base::trunc};
+            file.write(reinterpret_cast<const char*>(input.data()), static_cast<std::streamsize>(input.size()));
+        }
+
+        static void LoadCorpus(
+            _In_ const FuzzOptions& options,
+            _Inout_ std::vector<std::vector<std::byte>>& corpus)
+        {
+            std::error_code ec;
+            if (options.m_CorpusDirectory.empty() || !std::filesystem::is_directory(options.m_CorpusDirectory, ec))
+            {
+                return;
+            }
+
+            for (const auto& entry : std::filesystem::directory_iterator{options.m_CorpusDirectory, ec})
+            {
+                if (!entry.is_regular_file(ec) || (entry.file_size(ec) > options.m_MaxInputLength))
+                {
+                    continue;
+                }
+
+                std::ifstream file{entry.path(), std::ios_base::binary};
+                std::vector<std::byte> data(static_cast<std::size_t>(entry.file_size(ec)));
+                if (file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())))
+                {
+                    corpus.push_back(std::move(data));
+                }
+            }
+        }
+
+        // Returns true if the last run hit an edge/hit-count bucket never seen before (RunOne clears the counters).
+        [[nodiscard]] static bool CollectCoverage(_Inout_ std::vector<std::uint8_t>& seenBuckets) noexcept
+        {
+            // Most counters are zero on any given run, so skip them a word at a time.
+            bool bNewCoverage{false};
+            for (std::size_t wordPos = 0; wordPos < Internal_::g_cFuzzEdgeCounterCount; wordPos += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, Internal_::g_FuzzEdgeCounters + wordPos, sizeof(word));
+                if (word == 0)
+                {
+                    continue;
+                }
+
+                for (std::size_t i = wordPos; i < wordPos + sizeof(std::uint64_t); ++i)
+                {
+                    const std::uint8_t bucketMask{Internal_::FuzzHitCountToBucketMask(Internal_::g_FuzzEdgeCounters[i])};
+                    if ((bucketMask & ~seenBuckets[i]) != 0)
+                    {
+                        seenBuckets[i] |= bucketMask;
+                        bNewCoverage = true;
+                    }
+                }
+            }
+
+            return bNewCoverage;
+        }
+
+        class CrashHandlerScope
+        {
+        public:
+
+            explicit CrashHandlerScope(_In_ const std::filesystem::path& artifactDirectory)
+            {
+#if defined(__unix__) || defined(__APPLE__)
+                const std::string prefix{(artifactDirectory / "crash-").string()};
+                Internal_::g_FuzzCrashPathPrefixLength = std::min(prefix.size(), Internal_::g_FuzzCrashPathPrefix.size() - 1);
+                std::ranges::copy_n(prefix.begin(), static_cast<std::ptrdiff_t>(Internal_::g_FuzzCrashPathPrefixLength), Internal_::g_FuzzCrashPathPrefix.begin());
+                for (const int signal : Internal_::g_cFuzzCrashSignals)
+                {
+                    std::signal(signal, Internal_::FuzzCrashSignalHandler);
+                }
+#else
+                (void)artifactDirectory;
+#endif
+            }
+
+            CrashHandlerScope(const CrashHandlerScope&) = delete;
+            CrashHandlerScope& operator=(const CrashHandlerScope&) = delete;
+
+            ~CrashHandlerScope() noexcept
+            {
+#if defined(__unix__) || defined(__APPLE__)
+                for (const int signal : Internal_::g_cFuzzCrashSignals)
+                {
+                    std::signal(signal, SIG_DFL);
+                }
+#endif
+                Internal_::g_pFuzzCurrentInput = nullptr;
+                Internal_::g_FuzzCurrentInputSize = 0;
+            }
+        };
+
+    public:
+
+        FuzzTarget(
+            _In_ const std::string_view targetNameSV,
+            _In_ const FuzzTestFunction fuzzFn) :
+            m_TargetName{targetNameSV},
+            m_FuzzFn{fuzzFn}
+        { }
+
+        [[nodiscard]] std::string_view GetTargetName() const noexcept
+        {
+            return m_TargetName;
+        }
+
+        [[nodiscard]] const Result& GetResult() const noexcept
+        {
+            return m_Result;
+        }
+
+        // Runs the target once on a single input (e.g., to replay a saved crash artifact).
+        [[nodiscard]] Result RunOne(_In_ const std::span<const std::byte> input) const
+        {
+            Internal_::g_pFuzzCurrentInput = input.data();
+            Internal_::g_FuzzCurrentInputSize = input.size();
+
+            // Cleared right before the call, so edges hit by the harness itself (mutating and copying the input, which
+            // is header code instrumented along with the target) aren't credited to this input.
+            std::memset(Internal_::g_FuzzEdgeCounters, 0, sizeof(Internal_::g_FuzzEdgeCounters));
+            try
+            {
+                return m_FuzzFn(input);
+            }
+            catch (const std::exception& e)
+            {
+                return Result{ResultType::UnhandledException, std::source_location::current(), e.what()};
+            }
+            catch (...)
+            {
+                return Result{ResultType::UnhandledException, std::source_location::current(), "Unknown exception"};
+            }
+        }
+
+        const Result& operator()(_In_ const FuzzOptions& options = {}) const
+        {
+            std::vector<std::vector<std::byte>> corpus;
+            LoadCorpus(options, corpus);
+            if (corpus.empty())
+            {
+                corpus.emplace_back();
+            }
+
+            std::error_code ec;
+            if (!options.m_CorpusDirectory.empty())
+            {
+                std::filesystem::create_directories(options.m_CorpusDirectory, ec);
+            }
+            std::filesystem::create_directories(options.m_ArtifactDirectory, ec);
+
+            const std::uint64_t seed{(options.m_Seed != 0) ? options.m_Seed : std::random_device{}()};
+            FuzzMutator mutator{seed, options.m_Dictionary, options.m_MaxInputLength};
+            std::vector<std::uint8_t> seenBuckets(Internal_::g_cFuzzEdgeCounterCount);
+            std::mt19937_64 rng{seed ^ 0x9E3779B97F4A7C15ull};
+
+            const CrashHandlerScope crashHandlerScope{options.m_ArtifactDirectory};
+            const auto deadline{std::chrono::steady_clock::now() + options.m_MaxDuration};
+
+            auto Execute = [&](_In_ const std::span<const std::byte> input) -> bool
+            {
+                Result result{RunOne(input)};
+                if (!result)
+                {
+                    const std::filesystem::path artifactPath{
+                        options.m_ArtifactDirectory / std::format("failure-{}", HashToHex(input))};
+                    WriteInput(artifactPath, input);
+                    result.m_Info = std::format("{} [input saved to {}]", result.m_Info, artifactPath.string());
+                    if (options.m_Seed == 0)
+                    {
+                        // Reproduce the run with FuzzOptions::m_Seed.
+                        std::format_to(std::back_inserter(result.m_Info), " [seed {}]", seed);
+                    }
+                    m_Result = std::move(result);
+                    return false;
+                }
+
+                return true;
+            };
+
+            // Replay the seed corpus first so known-bad inputs fail fast, and to prime the coverage map.
+            for (const auto& input : corpus)
+            {
+                if (!Execute(input))
+                {
+                    return m_Result;
+                }
+                (void)CollectCoverage(seenBuckets);
+            }
+
+            std::uint64_t iteration{0};
+            for (; iteration < options.m_MaxIterations; ++iteration)
+            {
+                if ((options.m_MaxDuration.count() != 0) && ((iteration & 0xFF) == 0) && (std::chrono::steady_clock::now() >= deadline))
+                {
+                    break;
+                }
+
+                const auto& base{corpus[static_cast<std::size_t>(rng() % corpus.size())]};
+                std::vector<std::byte> input{((rng() & 7) == 0)
+                    ? mutator.Splice(base, corpus[static_cast<std::size_t>(rng() % corpus.size())])
+                    : base};
+                mutator.Mutate(input);
+
+                if (!Execute(input))
+                {
+                    return m_Result;
+                }
+
+                if (CollectCoverage(seenBuckets))
+                {
+                    if (!options.m_CorpusDirectory.empty())
+                    {
+                        WriteInput(options.m_CorpusDirectory / HashToHex(input), input);
+                    }
+                    corpus.push_back(std::move(input));
+                }
+            }
+
+            m_Result = Result{
+                ResultType::Success,
+                std::source_location::current(),
+                std::format("{} iterations, corpus size {}", iteration, corpus.size())};
+            return m_Result;
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,61 @@
+#pragma once
+
+// Opt-in coverage feedback for fuzz targets: include this header in exactly ONE translation unit of a test executable
+// built with -fsanitize-coverage=trace-pc-guard (Clang) or -fsanitize-coverage=trace-pc (GCC). It defines the coverage
+// callbacks those flags emit calls to, feeding the edge counters that guide FuzzTarget's mutations; without it (or
+// without the flags), the fuzzer degrades to blind mutation of its corpus.
+//
+// The callbacks are weak, so a sanitizer runtime (or libFuzzer) linked into the same binary takes precedence.
+//
+// This header is deliberately not part of SimpleUnitTestLibrary.h, nor a module: the callbacks are global runtime symbols,
+// which only a program that asks for them should get, and must be defined exactly once per program.
+
+#if !defined(SUTL_USE_MODULES)
+#include <cstdint>
+
+#include "SimpleUnitTestLibrary.Fuzz.h"
+#endif
+
+#if !defined(SUTL_NO_SANITIZE_COVERAGE_)
+#if defined(__clang__)
+#define SUTL_NO_SANITIZE_COVERAGE_ __attribute__((no_sanitize("coverage")))
+#elif defined(__GNUC__)
+#define SUTL_NO_SANITIZE_COVERAGE_ __attribute__((no_sanitize_coverage))
+#else
+#define SUTL_NO_SANITIZE_COVERAGE_
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+extern "C" __attribute__((weak, used)) SUTL_NO_SANITIZE_COVERAGE_
+void __sanitizer_cov_trace_pc_guard_init(std::uint32_t* pStart, std::uint32_t* pStop)
+{
+    if ((pStart == pStop) || (*pStart != 0))
+    {
+        return;
+    }
+
+    for (std::uint32_t* pGuard = pStart; pGuard < pStop; ++pGuard)
+    {
+        *pGuard = SimpleUnitTestLibrary::Internal_::g_FuzzNextGuardId++;
+    }
+}
+
+extern "C" __attribute__((weak, used)) SUTL_NO_SANITIZE_COVERAGE_
+void __sanitizer_cov_trace_pc_guard(std::uint32_t* pGuard)
+{
+    if (*pGuard != 0)
+    {
+        ++SimpleUnitTestLibrary::Internal_::g_FuzzEdgeCounters[
+            *pGuard & (SimpleUnitTestLibrary::Internal_::g_cFuzzEdgeCounterCount - 1)];
+    }
+}
+
+extern "C" __attribute__((weak, used)) SUTL_NO_SANITIZE_COVERAGE_
+void __sanitizer_cov_trace_pc()
+{
+    const auto pc{reinterpret_cast<std::uintptr_t>(__builtin_return_address(0))};
+    ++SimpleUnitTestLibrary::Internal_::g_FuzzEdgeCounters[
+        (pc ^ (pc >> 16)) & (SimpleUnitTestLibrary::Internal_::g_cFuzzEdgeCounterCount - 1)];
+}
+#endif
@@ -0,0 +1,163 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <string_view>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#include "SimpleUnitTestLibrary.Utils.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // Streams a JUnit XML report, one <testcase> per test as it finishes.
+    // A <testsuite>'s totals aren't known when its start tag is written, so the tag is written with
+    // fixed-width placeholders that are overwritten in place when the suite ends; nothing is held in memory.
+    class JUnitReporter final : public Reporter
+    {
+    private:
+
+        // Same width as the values written by FormatSuiteTotals.
+        static constexpr std::string_view s_cSuiteTotalsPlaceholderSV{
+            R"(tests="0000000000" failures="0000000000" errors="0000000000" skipped="0000000000" time="0000000.000000")"};
+
+        Internal_::BufferedFileWriter m_Writer;
+        std::mutex m_WriterMutex;
+        std::uint64_t m_SuiteTotalsOffset{0};
+
+        [[nodiscard]] static std::string FormatSuiteTotals(
+            _In_ const ResultTypeCounts& resultTypeCounts,
+            _In_ const double seconds)
+        {
+            const std::uint64_t errorCount{resultTypeCounts[static_cast<std::size_t>(ResultType::UnhandledException)]};
+            return std::format(
+                R"(tests="{:010}" failures="{:010}" errors="{:010}" skipped="{:010}" time="{:014.6f}")",
+                std::accumulate(resultTypeCounts.cbegin(), resultTypeCounts.cend(), std::uint64_t{0}),
+                GetFailureCount(resultTypeCounts) - errorCount,
+                errorCount,
+                resultTypeCounts[static_cast<std::size_t>(ResultType::Skipped)] + resultTypeCounts[static_cast<std::size_t>(ResultType::NotRun)],
+                seconds);
+        }
+
+        [[nodiscard]] static double ToSeconds(
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) noexcept
+        {
+            return (endNs > beginNs) ? (static_cast<double>(endNs - beginNs) / 1e9) : 0.0;
+        }
+
+    public:
+
+        explicit JUnitReporter(_In_ const std::filesystem::path& path) :
+            m_Writer{path}
+        {
+            m_Writer.GetBuffer() += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites>\n";
+        }
+
+        ~JUnitReporter() noexcept override
+        {
+            m_Writer.GetBuffer() += "</testsuites>\n";
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return !!m_Writer;
+        }
+
+        void OnSuiteBegin(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::uint64_t) override
+        {
+            const std::scoped_lock lock{m_WriterMutex};
+            std::string& buffer{m_Writer.GetBuffer()};
+            buffer += "  <testsuite name=\"";
+            Internal_::AppendXmlEscaped(buffer, suiteNameSV);
+            buffer += "\" ";
+            m_SuiteTotalsOffset = m_Writer.GetOffset();
+            buffer += s_cSuiteTotalsPlaceholderSV;
+            buffer += ">\n";
+        }
+
+        void OnTestEnd(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::string_view testNameSV,
+            _In_ const TestStage,
+            _In_ const Result& result,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            const std::scoped_lock lock{m_WriterMutex};
+            std::string& buffer{m_Writer.GetBuffer()};
+            buffer += "    <testcase name=\"";
+            Internal_::AppendXmlEscaped(buffer, testNameSV);
+            buffer += "\" classname=\"";
+            Internal_::AppendXmlEscaped(buffer, suiteNameSV);
+            buffer += "\" file=\"";
+            Internal_::AppendXmlEscaped(buffer, result.m_SourceLocation.file_name());
+            std::format_to(std::back_inserter(buffer), "\" line=\"{}\" time=\"{:.6f}\"",
+                result.m_SourceLocation.line(), ToSeconds(beginNs, endNs));
+
+            auto AppendChild = [&buffer, &result](_In_ const std::string_view elementSV)
+            {
+                std::format_to(std::back_inserter(buffer), ">\n      <{} type=\"{}\" message=\"", elementSV, ResultTypeToString(result.m_ResultType));
+                Internal_::AppendXmlEscaped(buffer, result.m_Info);
+                buffer += "\">";
+                Internal_::AppendXmlEscaped(buffer, Utils::ParseFunctionName(result.m_SourceLocation.function_name()));
+                std::format_to(std::back_inserter(buffer), " ({} @ {})</{}>\n    </testcase>\n",
+                    Utils::ParseFileName(result.m_SourceLocation.file_name()), result.m_SourceLocation.line(), elementSV);
+            };
+
+            switch (result.m_ResultType)
+            {
+            case ResultType::Success:
+                buffer += "/>\n";
+                break;
+
+            case ResultType::NotRun:
+            case ResultType::Skipped:
+                buffer += ">\n      <skipped message=\"";
+                Internal_::AppendXmlEscaped(buffer, (result.m_ResultType == ResultType::NotRun) ? "Not run"sv : std::string_view{result.m_Info});
+                buffer += "\"/>\n    </testcase>\n";
+                break;
+
+            case ResultType::UnhandledException:
+                AppendChild("error"sv);
+                break;
+
+            default:
+                AppendChild("failure"sv);
+                break;
+            }
+
+            m_Writer.FlushIfFull();
+        }
+
+        void OnSuiteEnd(
+            _In_ const std::string_view,
+            _In_ const ResultTypeCounts& resultTypeCounts,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            const std::string suiteTotals{FormatSuiteTotals(resultTypeCounts, ToSeconds(beginNs, endNs))};
+
+            const std::scoped_lock lock{m_WriterMutex};
+            if (suiteTotals.size() == s_cSuiteTotalsPlaceholderSV.size())
+            {
+                m_Writer.Overwrite(m_SuiteTotalsOffset, suiteTotals);
+            }
+            m_Writer.GetBuffer() += "  </testsuite>\n";
+            m_Writer.FlushIfFull();
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,97 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // Streams one JSON object per line: a "test" record as each test finishes, and a "suite" record
+    // (with per-ResultType counts) as each suite finishes. Durations are in nanoseconds.
+    class JsonLinesReporter final : public Reporter
+    {
+    private:
+
+        Internal_::BufferedFileWriter m_Writer;
+        std::mutex m_WriterMutex;
+
+    public:
+
+        explicit JsonLinesReporter(_In_ const std::filesystem::path& path) :
+            m_Writer{path}
+        { }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return !!m_Writer;
+        }
+
+        void OnSuiteBegin(
+            _In_ const std::string_view,
+            _In_ const std::uint64_t) override
+        { }
+
+        void OnTestEnd(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const std::string_view testNameSV,
+            _In_ const TestStage testStage,
+            _In_ const Result& result,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            const std::scoped_lock lock{m_WriterMutex};
+            std::string& buffer{m_Writer.GetBuffer()};
+            buffer += R"({"type":"test","suite":")";
+            Internal_::AppendJsonEscaped(buffer, suiteNameSV);
+            buffer += R"(","name":")";
+            Internal_::AppendJsonEscaped(buffer, testNameSV);
+            std::format_to(std::back_inserter(buffer), R"(","stage":"{}","result":"{}","duration_ns":{},"file":")",
+                TestStageToString(testStage), ResultTypeToString(result.m_ResultType), (endNs > beginNs) ? (endNs - beginNs) : 0);
+            Internal_::AppendJsonEscaped(buffer, result.m_SourceLocation.file_name());
+            std::format_to(std::back_inserter(buffer), R"(","line":{})", result.m_SourceLocation.line());
+            if (!result.m_Info.empty())
+            {
+                buffer += R"(,"info":")";
+                Internal_::AppendJsonEscaped(buffer, result.m_Info);
+                buffer += '"';
+            }
+            buffer += "}\n";
+
+            m_Writer.FlushIfFull();
+        }
+
+        void OnSuiteEnd(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const ResultTypeCounts& resultTypeCounts,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            const std::scoped_lock lock{m_WriterMutex};
+            std::string& buffer{m_Writer.GetBuffer()};
+            buffer += R"({"type":"suite","suite":")";
+            Internal_::AppendJsonEscaped(buffer, suiteNameSV);
+            std::format_to(std::back_inserter(buffer), R"(","duration_ns":{},"counts":{{)", (endNs > beginNs) ? (endNs - beginNs) : 0);
+            for (std::size_t i = 0; i < resultTypeCounts.size(); ++i)
+            {
+                std::format_to(std::back_inserter(buffer), R"({}"{}":{})",
+                    (i == 0) ? ""sv : ","sv, ResultTypeToString(static_cast<ResultType>(i)), resultTypeCounts[i]);
+            }
+            buffer += "}}\n";
+
+            m_Writer.FlushIfFull();
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
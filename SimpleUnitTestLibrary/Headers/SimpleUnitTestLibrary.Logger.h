@@ -2,13 +2,15 @@
 
 #if !defined(SUTL_USE_MODULES)
 #include <concepts>
-#include <functional>
+#include <cstddef>
 #include <format>
+#include <functional>
 #include <print>
 #include <source_location>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 #include "APIAnnotations.h"
 #include "SimpleUnitTestLibrary.Utils.h"
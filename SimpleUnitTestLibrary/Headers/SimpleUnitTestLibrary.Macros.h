@@ -4,10 +4,14 @@
 import SimpleUnitTestLibrary.Test;
 import SimpleUnitTestLibrary.Result;
 import SimpleUnitTestLibrary.Logger;
+import SimpleUnitTestLibrary.StaticRegistry;
+import SimpleUnitTestLibrary.CompileTimeSuite;
 #else
 #include "SimpleUnitTestLibrary.Test.h"
 #include "SimpleUnitTestLibrary.Result.h"
 #include "SimpleUnitTestLibrary.Logger.h"
+#include "SimpleUnitTestLibrary.StaticRegistry.h"
+#include "SimpleUnitTestLibrary.CompileTimeSuite.h"
 #endif
 
 #define SUTL_STRINGIFY_(thing_to_string_) # thing_to_string_
@@ -22,5 +26,58 @@ import SimpleUnitTestLibrary.Logger;
 #define SUTL_TEST_ASSERT(expr_, ...)    if (!(expr_)) { __VA_OPT__(SUTL_LOG(__VA_ARGS__);) return SUTL::Result{SUTL::ResultType::TestFailure, std::source_location::current(), SUTL_STRINGIFY(expr_)}; }
 #define SUTL_CLEANUP_ASSERT(expr_, ...) if (!(expr_)) { __VA_OPT__(SUTL_LOG(__VA_ARGS__);) return SUTL::Result{SUTL::ResultType::CleanupFailure, std::source_location::current(), SUTL_STRINGIFY(expr_)}; }
 
+#define SUTL_TEST_ASSERT_SNAPSHOT(golden_path_, actual_) if (SUTL::Result snapshotResult_{SUTL::CompareSnapshot(golden_path_, actual_)}; !snapshotResult_) { return snapshotResult_; }
 
-#define SUTL_CREATE_UNIT_TEST(func_) SUTL::Test(SUTL_STRINGIFY(func_), func_)
+// Death tests run statement_ in a forked child; a Skipped result (no fork() on this platform) is passed through as well.
+// Declare tests using them with SUTL_CREATE_DEATH_TEST (or SUTL_STATIC_DEATH_TEST), which tags them SerialOnly.
+#define SUTL_TEST_ASSERT_EXIT(statement_, predicate_, stderr_regex_) if (SUTL::Result deathTestResult_{SUTL::RunDeathTest([&]() { statement_; }, predicate_, stderr_regex_, SUTL_STRINGIFY(statement_))}; deathTestResult_.m_ResultType != SUTL::ResultType::Success) { return deathTestResult_; }
+#define SUTL_TEST_ASSERT_DEATH(statement_, stderr_regex_) SUTL_TEST_ASSERT_EXIT(statement_, SUTL::DiedAbnormally{}, stderr_regex_)
+
+// Requires SimpleUnitTestLibrary.AllocationHooks.h in one translation unit; otherwise the assertion is Skipped (and passed through).
+#define SUTL_TEST_ASSERT_NO_ALLOCATIONS(statement_) if (SUTL::Result noAllocationsResult_{SUTL::ExpectNoAllocations([&]() { statement_; }, SUTL_STRINGIFY(statement_))}; noAllocationsResult_.m_ResultType != SUTL::ResultType::Success) { return noAllocationsResult_; }
+
+
+// Optionally followed by the test's tags, e.g., SUTL_CREATE_UNIT_TEST(MyTest, SUTL::Tag::Slow, SUTL::Tag::SerialOnly).
+#define SUTL_CREATE_UNIT_TEST(func_, ...) SUTL::Test(SUTL_STRINGIFY(func_), func_ __VA_OPT__(, SUTL::TestTags{__VA_ARGS__}))
+#define SUTL_CREATE_DEATH_TEST(func_, ...) SUTL::Test(SUTL_STRINGIFY(func_), func_, SUTL::TestTags{SUTL::Tag::SerialOnly __VA_OPT__(, __VA_ARGS__)})
+#define SUTL_CREATE_FUZZ_TARGET(func_) SUTL::FuzzTarget(SUTL_STRINGIFY(func_), func_)
+#define SUTL_CREATE_PARAMETERIZED_TEST(func_, source_) SUTL::MakeParameterizedTest(SUTL_STRINGIFY(func_), source_, func_)
+#define SUTL_CREATE_FIXTURE_TEST(func_, ...) SUTL::FixtureTest{SUTL_STRINGIFY(func_), func_ __VA_OPT__(, SUTL::TestTags{__VA_ARGS__})}
+
+
+// Async tests are coroutines returning SUTL::AsyncResult (see AsyncTest.h), so they co_return their results.
+#define SUTL_CO_TEST_SUCCESS() co_return SUTL::Result{SUTL::ResultType::Success, std::source_location::current()}
+#define SUTL_CO_TEST_SKIP(reason_str_) co_return SUTL::Result{SUTL::ResultType::Skipped, std::source_location::current(), reason_str_}
+#define SUTL_CO_TEST_ASSERT(expr_, ...) if (!(expr_)) { __VA_OPT__(SUTL_LOG(__VA_ARGS__);) co_return SUTL::Result{SUTL::ResultType::TestFailure, std::source_location::current(), SUTL_STRINGIFY(expr_)}; }
+
+// Optionally followed by the test's tags, like SUTL_CREATE_UNIT_TEST.
+#define SUTL_CREATE_ASYNC_TEST(func_, ...) SUTL::AsyncTest{SUTL_STRINGIFY(func_), func_ __VA_OPT__(, SUTL::TestTags{__VA_ARGS__})}
+
+
+// Static suites are constant descriptors collected by the linker (see StaticRegistry.h), so registering one runs no code at startup:
+//   constexpr SUTL::StaticTestDescriptor g_cMathTests[]{SUTL_STATIC_UNIT_TEST(AddTest), SUTL_STATIC_UNIT_TEST(BigAddTest, SUTL::Tag::Slow)};
+//   SUTL_REGISTER_STATIC_SUITE(g_cMathSuite, "MathSuite", g_cMathTests); // Optionally followed by suite setup and cleanup functions.
+// Register a suite in one source file only; a registration in a header would register it once per including file.
+#if defined(_MSC_VER)
+#pragma section("sutl$m", read)
+#define SUTL_STATIC_SUITE_SECTION_ __declspec(allocate("sutl$m"))
+#elif defined(__APPLE__)
+#define SUTL_STATIC_SUITE_SECTION_ __attribute__((used, section("__DATA,sutl_suites")))
+#elif __has_attribute(retain)
+#define SUTL_STATIC_SUITE_SECTION_ __attribute__((used, retain, section("sutl_suites")))
+#else
+#define SUTL_STATIC_SUITE_SECTION_ __attribute__((used, section("sutl_suites")))
+#endif
+
+#define SUTL_STATIC_UNIT_TEST(func_, ...) SUTL::StaticTestDescriptor{SUTL_STRINGIFY(func_), func_ __VA_OPT__(, SUTL::TestTags{__VA_ARGS__})}
+#define SUTL_STATIC_DEATH_TEST(func_, ...) SUTL::StaticTestDescriptor{SUTL_STRINGIFY(func_), func_, SUTL::TestTags{SUTL::Tag::SerialOnly __VA_OPT__(, __VA_ARGS__)}}
+#define SUTL_REGISTER_STATIC_SUITE(name_, suite_name_str_, test_descriptors_, ...) \
+    constexpr SUTL::StaticSuiteDescriptor name_{suite_name_str_, test_descriptors_ __VA_OPT__(, __VA_ARGS__)}; \
+    [[maybe_unused]] SUTL_STATIC_SUITE_SECTION_ static const SUTL::StaticSuiteDescriptor* const name_##RegistryEntry_{&name_}
+
+// Or run at compile time instead (see CompileTimeSuite.h), for cheap, pure-logic tests that needn't wait for the test run:
+//   SUTL_STATIC_SUITE(g_cMathSuite, "MathSuite", g_cMathTests); // Optionally followed by suite setup and cleanup functions.
+// The tests must be constexpr; a failure fails the build, with the failing test, its assertion, and its location in the diagnostic.
+#define SUTL_STATIC_SUITE(name_, suite_name_str_, test_descriptors_, ...) \
+    constexpr SUTL::StaticSuiteDescriptor name_{suite_name_str_, test_descriptors_ __VA_OPT__(, __VA_ARGS__)}; \
+    static_assert(SUTL::Internal_::StaticSuiteCheck<SUTL::EvaluateStaticSuite(name_)>::cbChecked)
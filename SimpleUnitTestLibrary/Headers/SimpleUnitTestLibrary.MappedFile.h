@@ -0,0 +1,221 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "APIAnnotations.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // Read-only memory mapping of a whole file.
+    // Construction never throws; check operator bool / GetErrorCode() before use.
+    // Empty files are valid and map to an empty span.
+    class [[nodiscard]] MappedFile
+    {
+    private:
+
+        std::filesystem::path m_Path;
+        const std::byte* m_pData{nullptr};
+        std::size_t m_Size{0};
+        std::error_code m_ErrorCode;
+
+        [[nodiscard]] static std::error_code GetLastErrorCode() noexcept
+        {
+#if defined(_WIN32)
+            return std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+#else
+            return std::error_code{errno, std::system_category()};
+#endif
+        }
+
+        void Map() noexcept
+        {
+#if defined(_WIN32)
+            const HANDLE hFile{::CreateFileW(
+                m_Path.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                nullptr)};
+            if (hFile == INVALID_HANDLE_VALUE)
+            {
+                m_ErrorCode = GetLastErrorCode();
+                return;
+            }
+
+            LARGE_INTEGER fileSize{};
+            if (!::GetFileSizeEx(hFile, &fileSize))
+            {
+                m_ErrorCode = GetLastErrorCode();
+            }
+            else if (fileSize.QuadPart > 0)
+            {
+                // The view keeps the mapping object (and file) alive, so both handles can be closed right away.
+                if (const HANDLE hMapping = ::CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr); hMapping == nullptr)
+                {
+                    m_ErrorCode = GetLastErrorCode();
+                }
+                else
+                {
+                    m_pData = static_cast<const std::byte*>(::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0));
+                    if (m_pData == nullptr)
+                    {
+                        m_ErrorCode = GetLastErrorCode();
+                    }
+                    else
+                    {
+                        m_Size = static_cast<std::size_t>(fileSize.QuadPart);
+                    }
+                    ::CloseHandle(hMapping);
+                }
+            }
+            ::CloseHandle(hFile);
+#else
+            const int fd{::open(m_Path.c_str(), O_RDONLY | O_CLOEXEC)};
+            if (fd < 0)
+            {
+                m_ErrorCode = GetLastErrorCode();
+                return;
+            }
+
+            struct stat fileStat{};
+            if (::fstat(fd, &fileStat) != 0)
+            {
+                m_ErrorCode = GetLastErrorCode();
+            }
+            else if (fileStat.st_size > 0)
+            {
+                // The mapping holds its own reference to the file, so the descriptor can be closed right away.
+                void* const pMapping{::mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0)};
+                if (pMapping == MAP_FAILED)
+                {
+                    m_ErrorCode = GetLastErrorCode();
+                }
+                else
+                {
+                    m_pData = static_cast<const std::byte*>(pMapping);
+                    m_Size = static_cast<std::size_t>(fileStat.st_size);
+                }
+            }
+            ::close(fd);
+#endif
+        }
+
+        void Unmap() noexcept
+        {
+            if (m_pData != nullptr)
+            {
+#if defined(_WIN32)
+                ::UnmapViewOfFile(m_pData);
+#else
+                ::munmap(const_cast<std::byte*>(m_pData), m_Size);
+#endif
+            }
+
+            m_pData = nullptr;
+            m_Size = 0;
+        }
+
+    public:
+
+        MappedFile() noexcept = default;
+
+        explicit MappedFile(_In_ std::filesystem::path path) noexcept :
+            m_Path{std::move(path)}
+        {
+            Map();
+        }
+
+        // No copy
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(_Inout_ MappedFile&& other) noexcept :
+            m_Path{std::move(other.m_Path)},
+            m_pData{std::exchange(other.m_pData, nullptr)},
+            m_Size{std::exchange(other.m_Size, 0)},
+            m_ErrorCode{other.m_ErrorCode}
+        { }
+
+        MappedFile& operator=(_Inout_ MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Unmap();
+                m_Path = std::move(other.m_Path);
+                m_pData = std::exchange(other.m_pData, nullptr);
+                m_Size = std::exchange(other.m_Size, 0);
+                m_ErrorCode = other.m_ErrorCode;
+            }
+
+            return *this;
+        }
+
+        ~MappedFile() noexcept
+        {
+            Unmap();
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return !m_ErrorCode;
+        }
+
+        [[nodiscard]] const std::filesystem::path& GetPath() const noexcept
+        {
+            return m_Path;
+        }
+
+        [[nodiscard]] std::error_code GetErrorCode() const noexcept
+        {
+            return m_ErrorCode;
+        }
+
+        [[nodiscard]] std::span<const std::byte> GetBytes() const noexcept
+        {
+            return {m_pData, m_Size};
+        }
+
+        [[nodiscard]] std::string_view GetText() const noexcept
+        {
+            return {reinterpret_cast<const char*>(m_pData), m_Size};
+        }
+
+        [[nodiscard]] const std::byte* data() const noexcept
+        {
+            return m_pData;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_Size;
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
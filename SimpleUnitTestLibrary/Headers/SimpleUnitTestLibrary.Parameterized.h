@@ -0,0 +1,220 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.MappedFile.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#include "SimpleUnitTestLibrary.Test.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Concepts
+    {
+        template <typename SourceT>
+        concept ParameterSource = requires (const SourceT source, const std::size_t index)
+        {
+            typename SourceT::value_type;
+            { source.size() } -> std::convertible_to<std::size_t>;
+            { source[index] } -> std::convertible_to<typename SourceT::value_type>;
+            { source.GetFile() } -> std::same_as<const MappedFile&>;
+        };
+    }
+
+    template <typename ParamT>
+    using ParameterizedTestFunction = Result(*)(const ParamT&);
+
+    // Parameters are fixed-size binary records, read straight out of the mapping on access.
+    // A trailing partial record is ignored.
+    template <typename RecordT>
+        requires std::is_trivially_copyable_v<RecordT>
+    class FixedRecordFileSource
+    {
+    private:
+
+        MappedFile m_File;
+        std::size_t m_HeaderSize;
+
+    public:
+
+        using value_type = RecordT;
+
+        explicit FixedRecordFileSource(
+            _In_ std::filesystem::path path,
+            _In_ const std::size_t headerSize = 0) :
+            m_File{std::move(path)},
+            m_HeaderSize{headerSize}
+        { }
+
+        [[nodiscard]] const MappedFile& GetFile() const noexcept
+        {
+            return m_File;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return (m_File.size() <= m_HeaderSize) ? 0 : (m_File.size() - m_HeaderSize) / sizeof(RecordT);
+        }
+
+        [[nodiscard]] RecordT operator[](_In_ const std::size_t index) const noexcept
+        {
+            // Mapped records carry no alignment guarantee, so copy rather than reinterpret.
+            RecordT record;
+            std::memcpy(&record, m_File.data() + m_HeaderSize + (index * sizeof(RecordT)), sizeof(RecordT));
+            return record;
+        }
+    };
+
+    // Parameters are the non-empty lines of a text file (e.g., CSV rows), without their line terminators.
+    // Each line's offset is indexed up front (one pass over the file), so any line is O(1) to get, from any thread.
+    class LineFileSource
+    {
+    private:
+
+        MappedFile m_File;
+        std::vector<std::size_t> m_LineOffsets;
+
+        // Returns the next non-empty line at or after offset, and the offset just past it.
+        [[nodiscard]] std::pair<std::string_view, std::size_t> ReadLine(_In_ std::size_t offset) const noexcept
+        {
+            const std::string_view text{m_File.GetText()};
+            while (offset < text.size())
+            {
+                const std::size_t newlinePos{text.find('\n', offset)};
+                const std::size_t lineEnd{(newlinePos == std::string_view::npos) ? text.size() : newlinePos};
+                std::string_view line{text.substr(offset, lineEnd - offset)};
+                offset = (newlinePos == std::string_view::npos) ? text.size() : newlinePos + 1;
+
+                if (line.ends_with('\r'))
+                {
+                    line.remove_suffix(1);
+                }
+                if (!line.empty())
+                {
+                    return {line, offset};
+                }
+            }
+
+            return {std::string_view{}, text.size()};
+        }
+
+    public:
+
+        using value_type = std::string_view;
+
+        // skipLineCount drops leading lines, e.g., a CSV header row.
+        explicit LineFileSource(
+            _In_ std::filesystem::path path,
+            _In_ const std::size_t skipLineCount = 0) :
+            m_File{std::move(path)}
+        {
+            const std::string_view text{m_File.GetText()};
+            std::size_t skippedLineCount{0};
+            for (std::size_t offset = 0; offset < text.size();)
+            {
+                const auto [line, nextOffset]{ReadLine(offset)};
+                if (!line.empty() && (skippedLineCount++ >= skipLineCount))
+                {
+                    m_LineOffsets.push_back(static_cast<std::size_t>(line.data() - text.data()));
+                }
+                offset = nextOffset;
+            }
+        }
+
+        [[nodiscard]] const MappedFile& GetFile() const noexcept
+        {
+            return m_File;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_LineOffsets.size();
+        }
+
+        [[nodiscard]] std::string_view operator[](_In_ const std::size_t index) const noexcept
+        {
+            return ReadLine(m_LineOffsets[index]).first;
+        }
+    };
+
+    template <Concepts::ParameterSource SourceT>
+    class ParameterizedTest final : public TestGenerator
+    {
+    private:
+
+        using ParamT = typename SourceT::value_type;
+
+        std::string m_TestName;
+        SourceT m_Source;
+        ParameterizedTestFunction<ParamT> m_TestFn;
+
+    public:
+
+        ParameterizedTest(
+            _In_ const std::string_view testNameSV,
+            _Inout_ SourceT source,
+            _In_ const ParameterizedTestFunction<ParamT> testFn) :
+            m_TestName{testNameSV},
+            m_Source{std::move(source)},
+            m_TestFn{testFn}
+        { }
+
+        [[nodiscard]] std::size_t GetTestCount() const override
+        {
+            // An unreadable parameter file is reported as a single failed test, named after the file, rather than silently running nothing.
+            return !m_Source.GetFile() ? 1 : m_Source.size();
+        }
+
+        void FormatTestName(
+            _In_ const std::size_t testIndex,
+            _Inout_ std::string& testName) const override
+        {
+            testName.clear();
+            if (const MappedFile& file{m_Source.GetFile()}; !file)
+            {
+                std::format_to(std::back_inserter(testName), "{}[{}]", m_TestName, file.GetPath().string());
+                return;
+            }
+
+            std::format_to(std::back_inserter(testName), "{}[{}]", m_TestName, testIndex);
+        }
+
+        [[nodiscard]] Result RunTest(_In_ const std::size_t testIndex) const override
+        {
+            if (const MappedFile& file{m_Source.GetFile()}; !file)
+            {
+                return Result{
+                    ResultType::SetupFailure,
+                    std::source_location::current(),
+                    std::format("Unable to read parameter file \"{}\": {}", file.GetPath().string(), file.GetErrorCode().message())};
+            }
+
+            return m_TestFn(m_Source[testIndex]);
+        }
+    };
+
+    template <Concepts::ParameterSource SourceT>
+    [[nodiscard]] std::unique_ptr<const TestGenerator> MakeParameterizedTest(
+        _In_ const std::string_view testNameSV,
+        _Inout_ SourceT source,
+        _In_ const ParameterizedTestFunction<typename SourceT::value_type> testFn)
+    {
+        return std::make_unique<const ParameterizedTest<SourceT>>(testNameSV, std::move(source), testFn);
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
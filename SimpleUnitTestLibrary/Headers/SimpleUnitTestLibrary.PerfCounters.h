@@ -0,0 +1,399 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "APIAnnotations.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    enum class PerfCounter : std::uint8_t
+    {
+        Cycles = 0,
+        Instructions,
+        CacheMisses,
+        BranchMisses,
+
+        _End,
+        _Begin = 0
+    };
+
+    namespace Internal_
+    {
+        using namespace std::string_view_literals;
+
+        inline constexpr std::array g_cPerfCounterStringViewArray
+        {
+            "cycles"sv,
+            "instructions"sv,
+            "cache misses"sv,
+            "branch misses"sv
+        };
+        static_assert(g_cPerfCounterStringViewArray.size() == static_cast<std::size_t>(PerfCounter::_End));
+    }
+
+    // Hardware counter deltas for the current thread over a measured span (a test, or a PerfCounterScope).
+    // Only populated when perf counters are enabled (Runner::m_bPerfCounters / --perf-counters).
+    struct PerfCounterStats
+    {
+        using CounterArray = std::array<std::uint64_t, static_cast<std::size_t>(PerfCounter::_End)>;
+
+        bool m_bMeasured{false};
+
+        // Bit per PerfCounter that the kernel/hardware actually provided.
+        std::uint8_t m_AvailableCounterMask{0};
+
+        // errno from perf_event_open when no counter could be opened at all.
+        int m_ErrorCode{0};
+
+        CounterArray m_Values{};
+
+        [[nodiscard]] constexpr bool IsAvailable(_In_ const PerfCounter counter) const noexcept
+        {
+            return m_bMeasured && ((m_AvailableCounterMask & (1u << static_cast<std::uint8_t>(counter))) != 0);
+        }
+
+        [[nodiscard]] constexpr std::uint64_t GetValue(_In_ const PerfCounter counter) const noexcept
+        {
+            return m_Values[static_cast<std::size_t>(counter)];
+        }
+
+        // Instructions per cycle; 0 when either counter is unavailable.
+        [[nodiscard]] constexpr double GetIPC() const noexcept
+        {
+            if (!IsAvailable(PerfCounter::Cycles) || !IsAvailable(PerfCounter::Instructions) || (GetValue(PerfCounter::Cycles) == 0))
+            {
+                return 0.0;
+            }
+
+            return static_cast<double>(GetValue(PerfCounter::Instructions)) / static_cast<double>(GetValue(PerfCounter::Cycles));
+        }
+
+        // E.g., cache misses per benchmark iteration.
+        [[nodiscard]] constexpr double GetPerOp(
+            _In_ const PerfCounter counter,
+            _In_ const std::uint64_t opCount) const noexcept
+        {
+            if (!IsAvailable(counter) || (opCount == 0))
+            {
+                return 0.0;
+            }
+
+            return static_cast<double>(GetValue(counter)) / static_cast<double>(opCount);
+        }
+
+        // Sums another span's counts into this one; only counters available in both stay available.
+        constexpr PerfCounterStats& operator+=(_In_ const PerfCounterStats& other) noexcept
+        {
+            if (!other.m_bMeasured)
+            {
+                return *this;
+            }
+
+            if (!m_bMeasured)
+            {
+                return *this = other;
+            }
+
+            m_AvailableCounterMask &= other.m_AvailableCounterMask;
+            for (std::size_t i = 0; i < m_Values.size(); ++i)
+            {
+                m_Values[i] += other.m_Values[i];
+            }
+
+            return *this;
+        }
+
+        // With a non-zero opCount (e.g., benchmark iterations), per-op figures are reported instead of totals.
+        [[nodiscard]] std::string ToString(_In_ const std::uint64_t opCount = 0) const
+        {
+            using namespace std::string_view_literals;
+
+            if (!m_bMeasured)
+            {
+                return "not measured";
+            }
+
+            if (m_AvailableCounterMask == 0)
+            {
+                return std::format("unavailable ({})", std::system_category().message(m_ErrorCode));
+            }
+
+            std::string str;
+            for (std::uint8_t i = 0; i < static_cast<std::uint8_t>(PerfCounter::_End); ++i)
+            {
+                const PerfCounter counter{static_cast<PerfCounter>(i)};
+                const std::string_view nameSV{Internal_::g_cPerfCounterStringViewArray[i]};
+                const std::string_view separatorSV{str.empty() ? ""sv : ", "sv};
+                if (!IsAvailable(counter))
+                {
+                    str += std::format("{}{} unavailable", separatorSV, nameSV);
+                }
+                else if (opCount == 0)
+                {
+                    str += std::format("{}{} {}", separatorSV, GetValue(counter), nameSV);
+                }
+                else
+                {
+                    str += std::format("{}{:.2f} {}/op", separatorSV, GetPerOp(counter, opCount), nameSV);
+                }
+            }
+
+            if (IsAvailable(PerfCounter::Cycles) && IsAvailable(PerfCounter::Instructions))
+            {
+                str += std::format(", IPC {:.2f}", GetIPC());
+            }
+
+            return str;
+        }
+    };
+
+    namespace Internal_
+    {
+        // Set by Runner (--perf-counters).
+        inline constinit std::atomic<bool> g_bPerfCountersEnabled{false};
+
+        // A raw (unscaled) read of a counter group, with the times it had been enabled and actually counting.
+        // Only the difference between two snapshots is meaningful (see ScaleMultiplexedDelta).
+        struct PerfCounterSnapshot
+        {
+            PerfCounterStats::CounterArray m_Values{};
+            std::uint64_t m_TimeEnabled{0};
+            std::uint64_t m_TimeRunning{0};
+        };
+
+        // When the kernel multiplexes the group, it only counted for part of the span; extrapolates the span's count to
+        // the whole span, i.e., delta value * delta enabled / delta running. Scaling each cumulative snapshot by its own
+        // ratio before subtracting would instead fold in however the group was scheduled before the span began.
+        [[nodiscard]] constexpr std::uint64_t ScaleMultiplexedDelta(
+            _In_ const std::uint64_t valueDelta,
+            _In_ const std::uint64_t timeEnabledDelta,
+            _In_ const std::uint64_t timeRunningDelta) noexcept
+        {
+            if (timeRunningDelta == 0)
+            {
+                // Never scheduled during the span, so there's nothing to extrapolate from.
+                return 0;
+            }
+
+            if (timeRunningDelta >= timeEnabledDelta)
+            {
+                return valueDelta;
+            }
+
+            return static_cast<std::uint64_t>(static_cast<double>(valueDelta) * (static_cast<double>(timeEnabledDelta) / static_cast<double>(timeRunningDelta)));
+        }
+
+        static_assert(ScaleMultiplexedDelta(1000, 50, 50) == 1000);
+        static_assert(ScaleMultiplexedDelta(1000, 100, 25) == 4000);
+        static_assert(ScaleMultiplexedDelta(1000, 100, 0) == 0);
+
+        // One counter group per thread, opened on first use and kept running; spans are measured by
+        // reading the whole group (a single read() per snapshot) at the start and end, so nothing is reset.
+        class PerfCounterGroup
+        {
+        private:
+
+            std::array<int, static_cast<std::size_t>(PerfCounter::_End)> m_Fds{-1, -1, -1, -1};
+
+            // PerfCounters in the order they were added to the group (which is the order read() reports them).
+            std::array<PerfCounter, static_cast<std::size_t>(PerfCounter::_End)> m_GroupOrder{};
+            std::size_t m_GroupSize{0};
+
+            int m_ErrorCode{0};
+
+#if defined(__linux__)
+            [[nodiscard]] static int OpenCounter(
+                _In_ const PerfCounter counter,
+                _In_ const int groupFd) noexcept
+            {
+                static constexpr std::array<std::uint64_t, static_cast<std::size_t>(PerfCounter::_End)> cConfigs
+                {
+                    PERF_COUNT_HW_CPU_CYCLES,
+                    PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_CACHE_MISSES,
+                    PERF_COUNT_HW_BRANCH_MISSES
+                };
+
+                perf_event_attr attr{};
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof(attr);
+                attr.config = cConfigs[static_cast<std::size_t>(counter)];
+                attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+
+                return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0 /*this thread*/, -1 /*any cpu*/, groupFd, PERF_FLAG_FD_CLOEXEC));
+            }
+#endif
+
+        public:
+
+            PerfCounterGroup() noexcept
+            {
+#if defined(__linux__)
+                for (std::uint8_t i = 0; i < static_cast<std::uint8_t>(PerfCounter::_End); ++i)
+                {
+                    const PerfCounter counter{static_cast<PerfCounter>(i)};
+                    const int fd{OpenCounter(counter, (m_GroupSize == 0) ? -1 : m_Fds[static_cast<std::size_t>(m_GroupOrder[0])])};
+                    if (fd < 0)
+                    {
+                        // Individual counters may be missing (e.g., in VMs); keep whatever the hardware offers.
+                        m_ErrorCode = errno;
+                        continue;
+                    }
+
+                    m_Fds[i] = fd;
+                    m_GroupOrder[m_GroupSize++] = counter;
+                }
+#else
+                m_ErrorCode = ENOSYS;
+#endif
+            }
+
+            PerfCounterGroup(const PerfCounterGroup&) = delete;
+            PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+            ~PerfCounterGroup() noexcept
+            {
+#if defined(__linux__)
+                for (const int fd : m_Fds)
+                {
+                    if (fd >= 0)
+                    {
+                        ::close(fd);
+                    }
+                }
+#endif
+            }
+
+            [[nodiscard]] std::uint8_t GetAvailableCounterMask() const noexcept
+            {
+                std::uint8_t mask{0};
+                for (std::size_t i = 0; i < m_GroupSize; ++i)
+                {
+                    mask |= static_cast<std::uint8_t>(1u << static_cast<std::uint8_t>(m_GroupOrder[i]));
+                }
+
+                return mask;
+            }
+
+            [[nodiscard]] int GetErrorCode() const noexcept
+            {
+                return m_ErrorCode;
+            }
+
+            // Current raw counter values and times; see ScaleMultiplexedDelta for turning two of them into a span's counts.
+            [[nodiscard]] PerfCounterSnapshot Read() const noexcept
+            {
+                PerfCounterSnapshot snapshot;
+#if defined(__linux__)
+                if (m_GroupSize == 0)
+                {
+                    return snapshot;
+                }
+
+                // { nr, time_enabled, time_running, value[nr] }
+                std::array<std::uint64_t, 3 + static_cast<std::size_t>(PerfCounter::_End)> buffer{};
+                const int leaderFd{m_Fds[static_cast<std::size_t>(m_GroupOrder[0])]};
+                if (::read(leaderFd, buffer.data(), sizeof(buffer)) <= 0)
+                {
+                    return snapshot;
+                }
+
+                snapshot.m_TimeEnabled = buffer[1];
+                snapshot.m_TimeRunning = buffer[2];
+                for (std::size_t i = 0; (i < buffer[0]) && (i < m_GroupSize); ++i)
+                {
+                    snapshot.m_Values[static_cast<std::size_t>(m_GroupOrder[i])] = buffer[3 + i];
+                }
+#endif
+                return snapshot;
+            }
+        };
+
+        [[nodiscard]] inline const PerfCounterGroup& GetThreadPerfCounterGroup() noexcept
+        {
+            static thread_local const PerfCounterGroup s_PerfCounterGroup;
+            return s_PerfCounterGroup;
+        }
+    }
+
+    [[nodiscard]] inline bool ArePerfCountersEnabled() noexcept
+    {
+        return Internal_::g_bPerfCountersEnabled.load(std::memory_order_relaxed);
+    }
+
+    // Measures the current thread's hardware counters from construction until GetStats().
+    // Does nothing (and reports "not measured") unless perf counters are enabled.
+    class [[nodiscard]] PerfCounterScope
+    {
+    private:
+
+        const Internal_::PerfCounterGroup* m_pGroup{nullptr};
+        Internal_::PerfCounterSnapshot m_StartSnapshot;
+
+    public:
+
+        PerfCounterScope() noexcept
+        {
+            if (ArePerfCountersEnabled())
+            {
+                m_pGroup = &Internal_::GetThreadPerfCounterGroup();
+                m_StartSnapshot = m_pGroup->Read();
+            }
+        }
+
+        PerfCounterScope(const PerfCounterScope&) = delete;
+        PerfCounterScope& operator=(const PerfCounterScope&) = delete;
+
+        [[nodiscard]] PerfCounterStats GetStats() const noexcept
+        {
+            if (m_pGroup == nullptr)
+            {
+                return PerfCounterStats{};
+            }
+
+            const Internal_::PerfCounterSnapshot endSnapshot{m_pGroup->Read()};
+            PerfCounterStats stats{
+                .m_bMeasured = true,
+                .m_AvailableCounterMask = m_pGroup->GetAvailableCounterMask(),
+                .m_ErrorCode = m_pGroup->GetErrorCode()};
+
+            auto Delta = [](_In_ const std::uint64_t begin, _In_ const std::uint64_t end) static constexpr noexcept
+            {
+                return (end >= begin) ? (end - begin) : 0;
+            };
+
+            const std::uint64_t timeEnabledDelta{Delta(m_StartSnapshot.m_TimeEnabled, endSnapshot.m_TimeEnabled)};
+            const std::uint64_t timeRunningDelta{Delta(m_StartSnapshot.m_TimeRunning, endSnapshot.m_TimeRunning)};
+            for (std::size_t i = 0; i < stats.m_Values.size(); ++i)
+            {
+                stats.m_Values[i] = Internal_::ScaleMultiplexedDelta(
+                    Delta(m_StartSnapshot.m_Values[i], endSnapshot.m_Values[i]),
+                    timeEnabledDelta,
+                    timeRunningDelta);
+            }
+
+            return stats;
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,167 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Internal_
+    {
+        [[nodiscard]] inline bool IsStdoutTerminal() noexcept
+        {
+#if defined(_WIN32)
+            return ::_isatty(::_fileno(stdout)) != 0;
+#else
+            return ::isatty(::fileno(stdout)) != 0;
+#endif
+        }
+
+        // E.g., "45s", "3m07s", "1h02m03s".
+        [[nodiscard]] inline std::string FormatDuration(_In_ const std::chrono::seconds duration)
+        {
+            const auto totalSeconds{duration.count()};
+            if (totalSeconds < 60)
+            {
+                return std::format("{}s", totalSeconds);
+            }
+
+            if (totalSeconds < 3600)
+            {
+                return std::format("{}m{:02}s", totalSeconds / 60, totalSeconds % 60);
+            }
+
+            return std::format("{}h{:02}m{:02}s", totalSeconds / 3600, (totalSeconds / 60) % 60, totalSeconds % 60);
+        }
+    }
+
+    // Reports run progress (tests done / total, failures so far, throughput, and ETA) from a background thread,
+    // reading the live run counters (see GetRunCounters), so the tests themselves pay nothing for it.
+    // On a terminal a single status line is redrawn in place; otherwise (e.g., CI logs) plain lines are printed, less often.
+    class [[nodiscard]] ProgressDisplay
+    {
+    private:
+
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::chrono::milliseconds s_cTerminalRefreshInterval{100};
+        static constexpr std::chrono::seconds s_cPlainRefreshInterval{10};
+
+        // Throughput is smoothed with this time constant, so the ETA follows the current pace
+        // (suites differ wildly in test duration) without jumping around on every refresh.
+        static constexpr double s_cThroughputTimeConstantSeconds{5.0};
+
+        const std::uint64_t m_TotalTestCount;
+        const bool m_bTerminal;
+        std::FILE* const m_pOutput;
+        const Clock::time_point m_StartTime{Clock::now()};
+
+        Clock::time_point m_LastUpdateTime{m_StartTime};
+        std::uint64_t m_LastCompletedCount{0};
+        double m_SmoothedTestsPerSecond{0.0};
+
+        std::mutex m_Mutex;
+        std::condition_variable_any m_WakeCondition;
+
+        // Last, so everything above is initialized before the thread starts (and outlives it).
+        std::jthread m_Thread;
+
+        void Update(_In_ const bool bFinal)
+        {
+            const RunCounters& runCounters{GetRunCounters()};
+            const std::uint64_t completedCount{runCounters.GetCompletedCount()};
+            const std::uint64_t failureCount{runCounters.GetFailureCount()};
+
+            const Clock::time_point now{Clock::now()};
+            const double elapsedSeconds{std::chrono::duration<double>(now - m_StartTime).count()};
+            const double intervalSeconds{std::chrono::duration<double>(now - m_LastUpdateTime).count()};
+            if (intervalSeconds > 0.0)
+            {
+                const double intervalTestsPerSecond{static_cast<double>(completedCount - m_LastCompletedCount) / intervalSeconds};
+                const double weight{(m_LastCompletedCount == 0) ? 1.0 : (1.0 - std::exp(-intervalSeconds / s_cThroughputTimeConstantSeconds))};
+                m_SmoothedTestsPerSecond += weight * (intervalTestsPerSecond - m_SmoothedTestsPerSecond);
+            }
+            m_LastUpdateTime = now;
+            m_LastCompletedCount = completedCount;
+
+            const double testsPerSecond{bFinal ? ((elapsedSeconds > 0.0) ? (static_cast<double>(completedCount) / elapsedSeconds) : 0.0) : m_SmoothedTestsPerSecond};
+            const std::uint64_t remainingCount{(m_TotalTestCount > completedCount) ? (m_TotalTestCount - completedCount) : 0};
+
+            std::string line{std::format(
+                "[{:>{}}/{} {:5.1f}%] {} failed | {:.1f} tests/s | {} elapsed",
+                completedCount, std::formatted_size("{}", m_TotalTestCount), m_TotalTestCount,
+                (m_TotalTestCount == 0) ? 100.0 : ((100.0 * static_cast<double>(completedCount)) / static_cast<double>(m_TotalTestCount)),
+                failureCount,
+                testsPerSecond,
+                Internal_::FormatDuration(std::chrono::seconds{static_cast<std::int64_t>(elapsedSeconds)}))};
+            if (!bFinal)
+            {
+                line += (testsPerSecond > 0.0)
+                    ? std::format(" | ETA {}", Internal_::FormatDuration(std::chrono::seconds{static_cast<std::int64_t>(static_cast<double>(remainingCount) / testsPerSecond)}))
+                    : " | ETA ?";
+            }
+
+            // "\r" + erase-to-end-of-line redraws the status line in place.
+            line = m_bTerminal ? std::format("\r{}\x1b[K{}", line, bFinal ? "\n" : "") : std::format("{}\n", line);
+            std::fwrite(line.data(), 1, line.size(), m_pOutput);
+            std::fflush(m_pOutput);
+        }
+
+        void Run(_In_ const std::stop_token stopToken)
+        {
+            const Clock::duration refreshInterval{m_bTerminal ? Clock::duration{s_cTerminalRefreshInterval} : Clock::duration{s_cPlainRefreshInterval}};
+
+            std::unique_lock lock{m_Mutex};
+            while (!m_WakeCondition.wait_for(lock, stopToken, refreshInterval, []() static { return false; }) && !stopToken.stop_requested())
+            {
+                const Internal_::ForkGateWorkScope forkGateWorkScope;
+                Update(false);
+            }
+        }
+
+    public:
+
+        // Writes to stdout unless given another stream (e.g., to capture the output).
+        explicit ProgressDisplay(
+            _In_ const std::uint64_t totalTestCount,
+            _In_ const bool bTerminal = Internal_::IsStdoutTerminal(),
+            _Inout_ std::FILE* const pOutput = stdout) :
+            m_TotalTestCount{totalTestCount},
+            m_bTerminal{bTerminal},
+            m_pOutput{pOutput},
+            m_Thread{[this](_In_ const std::stop_token stopToken) { Run(stopToken); }}
+        { }
+
+        ProgressDisplay(const ProgressDisplay&) = delete;
+        ProgressDisplay& operator=(const ProgressDisplay&) = delete;
+
+        // Stops the refresh thread and prints the final tally.
+        ~ProgressDisplay() noexcept
+        {
+            m_Thread.request_stop();
+            m_Thread.join();
+            Update(true);
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
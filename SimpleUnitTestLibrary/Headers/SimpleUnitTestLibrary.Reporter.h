@@ -0,0 +1,274 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    enum class TestStage : std::uint8_t
+    {
+        SuiteSetup,
+        Test,
+        SuiteCleanup
+    };
+
+    [[nodiscard]] constexpr std::string_view TestStageToString(_In_ const TestStage testStage) noexcept
+    {
+        switch (testStage)
+        {
+        case TestStage::SuiteSetup:
+            return "setup"sv;
+
+        case TestStage::SuiteCleanup:
+            return "cleanup"sv;
+        }
+
+        return "test"sv;
+    }
+
+    // Receives results incrementally while suites run (e.g., to stream them into a report file).
+    // Timestamps are steady-clock nanoseconds (see Internal_::GetTimestampNs).
+    class Reporter
+    {
+    public:
+
+        virtual ~Reporter() noexcept = default;
+
+        virtual void OnSuiteBegin(
+            _In_ std::string_view suiteNameSV,
+            _In_ std::uint64_t beginNs) = 0;
+
+        virtual void OnTestEnd(
+            _In_ std::string_view suiteNameSV,
+            _In_ std::string_view testNameSV,
+            _In_ TestStage testStage,
+            _In_ const Result& result,
+            _In_ std::uint64_t beginNs,
+            _In_ std::uint64_t endNs) = 0;
+
+        // resultTypeCounts covers every test in the suite, including ones never reported through OnTestEnd
+        // (e.g., generated tests that were not run because suite setup failed).
+        virtual void OnSuiteEnd(
+            _In_ std::string_view suiteNameSV,
+            _In_ const ResultTypeCounts& resultTypeCounts,
+            _In_ std::uint64_t beginNs,
+            _In_ std::uint64_t endNs) = 0;
+    };
+
+    namespace Internal_
+    {
+        // Set by Runner for the duration of a run when any reporter is enabled.
+        inline constinit std::atomic<const std::vector<Reporter*>*> g_pActiveReporters{nullptr};
+
+        [[nodiscard]] inline const std::vector<Reporter*>* GetActiveReporters() noexcept
+        {
+            return g_pActiveReporters.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] inline std::uint64_t GetTimestampNs() noexcept
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        inline void AppendJsonEscaped(
+            _Inout_ std::string& buffer,
+            _In_ const std::string_view textSV)
+        {
+            // Text rarely needs escaping, so copy runs of it at once.
+            auto NeedsEscaping = [](_In_ const char c) static constexpr
+            {
+                return (c == '"') || (c == '\\') || (static_cast<unsigned char>(c) < 0x20);
+            };
+
+            for (auto itr = textSV.cbegin(); itr != textSV.cend();)
+            {
+                const auto runEnd{std::find_if(itr, textSV.cend(), NeedsEscaping)};
+                buffer.append(itr, runEnd);
+                if (runEnd == textSV.cend())
+                {
+                    break;
+                }
+
+                const char c{*runEnd};
+                itr = runEnd + 1;
+                switch (c)
+                {
+                case '"':
+                    buffer += "\\\"";
+                    break;
+
+                case '\\':
+                    buffer += "\\\\";
+                    break;
+
+                default:
+                    std::format_to(std::back_inserter(buffer), "\\u{:04x}", static_cast<unsigned int>(c));
+                    break;
+                }
+            }
+        }
+
+        // Escapes for use in attribute values as well as text; control characters XML 1.0 can't represent become '?'.
+        inline void AppendXmlEscaped(
+            _Inout_ std::string& buffer,
+            _In_ const std::string_view textSV)
+        {
+            for (const char c : textSV)
+            {
+                switch (c)
+                {
+                case '&':
+                    buffer += "&amp;";
+                    break;
+
+                case '<':
+                    buffer += "&lt;";
+                    break;
+
+                case '>':
+                    buffer += "&gt;";
+                    break;
+
+                case '"':
+                    buffer += "&quot;";
+                    break;
+
+                case '\n':
+                    buffer += "&#10;";
+                    break;
+
+                case '\t':
+                case '\r':
+                    buffer += c;
+                    break;
+
+                default:
+                    buffer += (static_cast<unsigned char>(c) < 0x20) ? '?' : c;
+                    break;
+                }
+            }
+        }
+
+        // Report files are formatted straight into one in-memory buffer and written out in large chunks,
+        // so an event costs a short format_to - no per-event allocation or I/O.
+        class BufferedFileWriter
+        {
+        private:
+
+            static constexpr std::size_t s_cFlushThreshold{1u << 18};
+
+            std::FILE* m_pFile{nullptr};
+            std::string m_Buffer;
+            std::uint64_t m_FlushedSize{0};
+
+        public:
+
+            explicit BufferedFileWriter(_In_ const std::filesystem::path& path)
+            {
+#if defined(_WIN32)
+                m_pFile = ::_wfopen(path.c_str(), L"wb");
+#else
+                m_pFile = std::fopen(path.c_str(), "wb");
+#endif
+                if (m_pFile != nullptr)
+                {
+                    // We do our own buffering.
+                    std::setvbuf(m_pFile, nullptr, _IONBF, 0);
+                    m_Buffer.reserve(s_cFlushThreshold + 4096);
+                }
+            }
+
+            BufferedFileWriter(const BufferedFileWriter&) = delete;
+            BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+            ~BufferedFileWriter() noexcept
+            {
+                if (m_pFile != nullptr)
+                {
+                    Flush();
+                    std::fclose(m_pFile);
+                }
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept
+            {
+                return m_pFile != nullptr;
+            }
+
+            // Append to this directly (e.g., with std::format_to(std::back_inserter(...))), then call FlushIfFull().
+            [[nodiscard]] std::string& GetBuffer() noexcept
+            {
+                return m_Buffer;
+            }
+
+            // Offset in the file at which the next appended byte will land.
+            [[nodiscard]] std::uint64_t GetOffset() const noexcept
+            {
+                return m_FlushedSize + m_Buffer.size();
+            }
+
+            void FlushIfFull() noexcept
+            {
+                if (m_Buffer.size() >= s_cFlushThreshold)
+                {
+                    Flush();
+                }
+            }
+
+            void Flush() noexcept
+            {
+                if ((m_pFile != nullptr) && !m_Buffer.empty())
+                {
+                    std::fwrite(m_Buffer.data(), 1, m_Buffer.size(), m_pFile);
+                }
+                m_FlushedSize += m_Buffer.size();
+                m_Buffer.clear();
+            }
+
+            // Replaces already-appended bytes at offset (e.g., fixed-width placeholders) with same-length text.
+            void Overwrite(
+                _In_ const std::uint64_t offset,
+                _In_ const std::string_view textSV) noexcept
+            {
+                if (offset >= m_FlushedSize)
+                {
+                    m_Buffer.replace(static_cast<std::size_t>(offset - m_FlushedSize), textSV.size(), textSV);
+                    return;
+                }
+
+                Flush();
+                if (m_pFile != nullptr)
+                {
+#if defined(_WIN32)
+                    ::_fseeki64(m_pFile, static_cast<long long>(offset), SEEK_SET);
+                    std::fwrite(textSV.data(), 1, textSV.size(), m_pFile);
+                    ::_fseeki64(m_pFile, 0, SEEK_END);
+#else
+                    ::fseeko(m_pFile, static_cast<off_t>(offset), SEEK_SET);
+                    std::fwrite(textSV.data(), 1, textSV.size(), m_pFile);
+                    ::fseeko(m_pFile, 0, SEEK_END);
+#endif
+                }
+            }
+        };
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
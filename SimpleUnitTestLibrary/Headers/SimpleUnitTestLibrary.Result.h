@@ -1,15 +1,26 @@
 #pragma once
 
 #if !defined(SUTL_USE_MODULES)
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <format>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <source_location>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.AllocationTracking.h"
 #include "SimpleUnitTestLibrary.Logger.h"
+#include "SimpleUnitTestLibrary.PerfCounters.h"
 #include "SimpleUnitTestLibrary.Utils.h"
 #endif
 
@@ -37,8 +48,25 @@ namespace SimpleUnitTestLibrary
             "CleanupFailure"sv,
 
             // Test threw exception
-            "UnhandledException"sv
+            "UnhandledException"sv,
+
+            // Test succeeded, but leaked heap memory (allocation tracking only)
+            "LeakFailure"sv
         };
+
+        // Report formatting hot path: left-aligns text in a field of width bytes (it is never truncated) after indenting by
+        // spaces. Cheaper than a "{:<{}}" std::format_to per field, which matters once a report has tens of thousands of lines.
+        template <std::output_iterator<char> OutputItT>
+        OutputItT FormatPaddedTo(
+            _In_ OutputItT out,
+            _In_ const std::size_t spaces,
+            _In_ const std::string_view textSV,
+            _In_ const std::size_t width = 0)
+        {
+            out = std::fill_n(std::move(out), spaces, ' ');
+            out = std::ranges::copy(textSV, std::move(out)).out;
+            return std::fill_n(std::move(out), width - std::min(width, textSV.size()), ' ');
+        }
     }
 }
 
@@ -62,6 +90,7 @@ namespace SimpleUnitTestLibrary
 
         // Test failures.
         UnhandledException,
+        LeakFailure,
 
         _End,
         _Last = _End - 1,
@@ -69,14 +98,200 @@ namespace SimpleUnitTestLibrary
     };
     static_assert(Internal_::g_cResultTypeStringViewArray.size() == static_cast<std::size_t>(ResultType::_End));
 
+    // Number of tests per ResultType, indexed by the ResultType's value.
+    using ResultTypeCounts = std::array<std::uint64_t, static_cast<std::size_t>(ResultType::_End)>;
+
+    [[nodiscard]] constexpr std::uint64_t GetFailureCount(_In_ const ResultTypeCounts& resultTypeCounts) noexcept
+    {
+        return resultTypeCounts[static_cast<std::size_t>(ResultType::SetupFailure)]
+            + resultTypeCounts[static_cast<std::size_t>(ResultType::TestFailure)]
+            + resultTypeCounts[static_cast<std::size_t>(ResultType::CleanupFailure)]
+            + resultTypeCounts[static_cast<std::size_t>(ResultType::UnhandledException)]
+            + resultTypeCounts[static_cast<std::size_t>(ResultType::LeakFailure)];
+    }
+
+    // Per-ResultType tallies that tests update as they complete and that can be read at any time, from any thread
+    // (e.g., by a progress display while a run is in flight); every query is O(1).
+    class RunCounters
+    {
+    private:
+
+        std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(ResultType::_End)> m_ResultTypeCounts{};
+
+    public:
+
+        void Record(
+            _In_ const ResultType resultType,
+            _In_ const std::uint64_t count = 1) noexcept
+        {
+            m_ResultTypeCounts[static_cast<std::size_t>(resultType)].fetch_add(count, std::memory_order_relaxed);
+        }
+
+        void Reset() noexcept
+        {
+            for (std::atomic<std::uint64_t>& count : m_ResultTypeCounts)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        // Individually-consistent counts; a concurrent update may land between reading two of them.
+        [[nodiscard]] ResultTypeCounts GetResultTypeCounts() const noexcept
+        {
+            ResultTypeCounts resultTypeCounts{};
+            for (std::size_t i = 0; i < resultTypeCounts.size(); ++i)
+            {
+                resultTypeCounts[i] = m_ResultTypeCounts[i].load(std::memory_order_relaxed);
+            }
+
+            return resultTypeCounts;
+        }
+
+        [[nodiscard]] std::uint64_t GetCount(_In_ const ResultType resultType) const noexcept
+        {
+            return m_ResultTypeCounts[static_cast<std::size_t>(resultType)].load(std::memory_order_relaxed);
+        }
+
+        // Tests accounted for so far, including ones that won't run (e.g., after a suite setup failure).
+        [[nodiscard]] std::uint64_t GetCompletedCount() const noexcept
+        {
+            const ResultTypeCounts resultTypeCounts{GetResultTypeCounts()};
+            return std::accumulate(resultTypeCounts.cbegin(), resultTypeCounts.cend(), std::uint64_t{0});
+        }
+
+        [[nodiscard]] std::uint64_t GetFailureCount() const noexcept
+        {
+            return SimpleUnitTestLibrary::GetFailureCount(GetResultTypeCounts());
+        }
+    };
+
+    namespace Internal_
+    {
+        // Reset by Runner at the start of each run.
+        inline constinit RunCounters g_RunCounters;
+    }
+
+    // Live counts for the current (or last) run, across all suites.
+    [[nodiscard]] inline const RunCounters& GetRunCounters() noexcept
+    {
+        return Internal_::g_RunCounters;
+    }
+
+    namespace Internal_
+    {
+        // Keeps fork() (death tests) from running while the library's own threads run work that may hold the allocator's
+        // or stdio's locks - pipelined suite setups, fixture workers' tests, event loop resumes, progress redraws - which a
+        // child forked then would wait on until its timeout. Work waits for a fork in progress; a fork waits for the work
+        // in progress, bar the forking thread's own (e.g., a fixture worker's test that forks).
+        class ForkGate
+        {
+        private:
+
+            std::mutex m_Mutex;
+            std::condition_variable m_Condition;
+            std::size_t m_ActiveWorkCount{0};
+            bool m_bForking{false};
+
+            [[nodiscard]] static std::size_t& GetThreadWorkDepth() noexcept
+            {
+                static thread_local std::size_t t_WorkDepth{0};
+                return t_WorkDepth;
+            }
+
+        public:
+
+            void EnterWork()
+            {
+                std::unique_lock lock{m_Mutex};
+                m_Condition.wait(lock, [this]() { return !m_bForking; });
+                ++m_ActiveWorkCount;
+                ++GetThreadWorkDepth();
+            }
+
+            void LeaveWork() noexcept
+            {
+                {
+                    const std::lock_guard lock{m_Mutex};
+                    --m_ActiveWorkCount;
+                    --GetThreadWorkDepth();
+                }
+                m_Condition.notify_all();
+            }
+
+            // The calling thread's own work stops counting while it waits, so two threads forking at once don't wait on each other.
+            void BeginFork()
+            {
+                std::unique_lock lock{m_Mutex};
+                m_ActiveWorkCount -= GetThreadWorkDepth();
+                m_Condition.wait(lock, [this]() { return !m_bForking; });
+                m_bForking = true;
+                m_Condition.wait(lock, [this]() { return m_ActiveWorkCount == 0; });
+            }
+
+            void EndFork() noexcept
+            {
+                {
+                    const std::lock_guard lock{m_Mutex};
+                    m_bForking = false;
+                    m_ActiveWorkCount += GetThreadWorkDepth();
+                }
+                m_Condition.notify_all();
+            }
+        };
+
+        [[nodiscard]] inline ForkGate& GetForkGate()
+        {
+            static ForkGate s_ForkGate;
+            return s_ForkGate;
+        }
+
+        // Held by a library thread around work that a fork mustn't interrupt.
+        class [[nodiscard]] ForkGateWorkScope
+        {
+        public:
+
+            ForkGateWorkScope()
+            {
+                GetForkGate().EnterWork();
+            }
+
+            ForkGateWorkScope(const ForkGateWorkScope&) = delete;
+            ForkGateWorkScope& operator=(const ForkGateWorkScope&) = delete;
+
+            ~ForkGateWorkScope() noexcept
+            {
+                GetForkGate().LeaveWork();
+            }
+        };
+
+        // Held around fork() itself; the parent can let work resume as soon as fork() returns.
+        class [[nodiscard]] ForkGateForkScope
+        {
+        public:
+
+            ForkGateForkScope()
+            {
+                GetForkGate().BeginFork();
+            }
+
+            ForkGateForkScope(const ForkGateForkScope&) = delete;
+            ForkGateForkScope& operator=(const ForkGateForkScope&) = delete;
+
+            ~ForkGateForkScope() noexcept
+            {
+                GetForkGate().EndFork();
+            }
+        };
+    }
+
     [[nodiscard]] constexpr bool IsResultTypeValid(
         _In_ const ResultType resultType) noexcept
     {
-        return (ResultType::NotRun <= resultType) && (resultType <= ResultType::UnhandledException);
+        return (ResultType::_Begin <= resultType) && (resultType <= ResultType::_Last);
     }
 
     [[nodiscard]] constexpr std::string_view ResultTypeToString(
-        _In_range_(ResultType::NotRun, ResultType::UnhandledException) const ResultType resultType) noexcept
+        _In_range_(ResultType::_Begin, ResultType::_Last) const ResultType resultType) noexcept
     {
         if (!IsResultTypeValid(resultType))
         {
@@ -86,6 +301,72 @@ namespace SimpleUnitTestLibrary
         return Internal_::g_cResultTypeStringViewArray[static_cast<std::size_t>(resultType)];
     }
 
+    // Heap activity and hardware counters measured around one run of a test (see Internal_::InvokeInstrumentedTest).
+    struct TestMeasurements
+    {
+        AllocationStats m_AllocationStats;
+        PerfCounterStats m_PerfCounterStats;
+    };
+
+    namespace Internal_
+    {
+        // An optional T kept on the heap, so holders that are rarely given a T pay a pointer for it rather than sizeof(T).
+        // Copies are deep.
+        template <typename T>
+        class HeapOptional
+        {
+        private:
+
+            std::unique_ptr<T> m_pValue;
+
+        public:
+
+            constexpr HeapOptional() noexcept = default;
+
+            constexpr HeapOptional(_In_ const HeapOptional& other)
+            {
+                if (other.m_pValue)
+                {
+                    m_pValue = std::make_unique<T>(*other.m_pValue);
+                }
+            }
+
+            constexpr HeapOptional(_Inout_ HeapOptional&& other) noexcept = default;
+
+            constexpr HeapOptional& operator=(_In_ const HeapOptional& other)
+            {
+                if (this == &other)
+                {
+                    return *this;
+                }
+
+                m_pValue.reset();
+                if (other.m_pValue)
+                {
+                    m_pValue = std::make_unique<T>(*other.m_pValue);
+                }
+
+                return *this;
+            }
+
+            constexpr HeapOptional& operator=(_Inout_ HeapOptional&& other) noexcept = default;
+
+            constexpr ~HeapOptional() noexcept = default;
+
+            constexpr T& Emplace(_In_ T value)
+            {
+                m_pValue = std::make_unique<T>(std::move(value));
+                return *m_pValue;
+            }
+
+            [[nodiscard]] constexpr const T* Get() const noexcept
+            {
+                return m_pValue.get();
+            }
+        };
+
+        inline constexpr TestMeasurements g_cUnmeasured{};
+    }
 
     struct [[nodiscard]] Result
     {
@@ -93,6 +374,22 @@ namespace SimpleUnitTestLibrary
         std::source_location m_SourceLocation;
         std::string m_Info;
 
+        // Only filled when allocation tracking or perf counters are enabled; most results never pay for the stats.
+        Internal_::HeapOptional<TestMeasurements> m_Measurements;
+
+        // Untracked/unmeasured (all zeros) when the test wasn't measured.
+        [[nodiscard]] constexpr const AllocationStats& GetAllocationStats() const noexcept
+        {
+            const TestMeasurements* pMeasurements{m_Measurements.Get()};
+            return ((pMeasurements != nullptr) ? *pMeasurements : Internal_::g_cUnmeasured).m_AllocationStats;
+        }
+
+        [[nodiscard]] constexpr const PerfCounterStats& GetPerfCounterStats() const noexcept
+        {
+            const TestMeasurements* pMeasurements{m_Measurements.Get()};
+            return ((pMeasurements != nullptr) ? *pMeasurements : Internal_::g_cUnmeasured).m_PerfCounterStats;
+        }
+
         [[nodiscard]] constexpr explicit operator bool() const noexcept
         {
             return (m_ResultType == ResultType::NotRun)
@@ -100,7 +397,11 @@ namespace SimpleUnitTestLibrary
                 || (m_ResultType == ResultType::Skipped);
         }
 
-        [[nodiscard]] std::string ToString(_In_ const std::size_t spaces = 0) const
+        // Formats straight into out (e.g., a pre-reserved buffer), so large reports need no per-result temporaries.
+        template <std::output_iterator<char> OutputItT>
+        OutputItT FormatTo(
+            _In_ OutputItT out,
+            _In_ const std::size_t spaces = 0) const
         {
             auto GetInfoFormatStringPrefix = [](_In_ const ResultType resultType) static constexpr
             {
@@ -111,18 +412,34 @@ namespace SimpleUnitTestLibrary
 
                 case ResultType::UnhandledException:
                     return "Exception:"sv;
+
+                case ResultType::LeakFailure:
+                    return "Leak:"sv;
                 }
 
                 return "Expression:"sv;
             };
 
-            std::string str;
-            str = std::format("{:<{}}Result: {}",
-                "", spaces, ResultTypeToString(m_ResultType));
+            out = Internal_::FormatPaddedTo(std::move(out), spaces, "Result: "sv);
+            out = Internal_::FormatPaddedTo(std::move(out), 0, ResultTypeToString(m_ResultType));
+            const AllocationStats& allocationStats{GetAllocationStats()};
+            if (allocationStats.m_bTracked)
+            {
+                out = std::format_to(std::move(out), " (");
+                out = allocationStats.FormatTo(std::move(out));
+                out = std::format_to(std::move(out), ")");
+            }
+            // When counters are unavailable altogether, that's reported once, in the suite summary.
+            const PerfCounterStats& perfCounterStats{GetPerfCounterStats()};
+            if (perfCounterStats.m_AvailableCounterMask != 0)
+            {
+                out = std::format_to(std::move(out), " ({})", perfCounterStats.ToString());
+            }
             if ((m_ResultType != ResultType::Success) &&
                 (m_ResultType != ResultType::NotRun))
             {
-                str += std::format(
+                out = std::format_to(
+                    std::move(out),
                     "\n{:<{}}{} {}\n{:<{}}Test: {} ({} @ {})\n",
                     "", spaces + 2, GetInfoFormatStringPrefix(m_ResultType), m_Info,
                     "", spaces + 2,
@@ -131,6 +448,13 @@ namespace SimpleUnitTestLibrary
                     m_SourceLocation.line());
             }
 
+            return out;
+        }
+
+        [[nodiscard]] std::string ToString(_In_ const std::size_t spaces = 0) const
+        {
+            std::string str;
+            FormatTo(std::back_inserter(str), spaces);
             return str;
         }
     };
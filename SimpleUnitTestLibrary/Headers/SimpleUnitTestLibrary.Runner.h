@@ -2,55 +2,439 @@
 
 #if !defined(SUTL_USE_MODULES)
 #include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <format>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <ranges>
+#include <string>
 #include <string_view>
+#include <system_error>
+#include <utility>
 #include <vector>
 
 #include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.AsyncTest.h"
+#include "SimpleUnitTestLibrary.BinaryResults.h"
+#include "SimpleUnitTestLibrary.Filter.h"
+#include "SimpleUnitTestLibrary.JsonLinesReporter.h"
+#include "SimpleUnitTestLibrary.JUnitReporter.h"
+#include "SimpleUnitTestLibrary.Logger.h"
+#include "SimpleUnitTestLibrary.Progress.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Shuffle.h"
+#include "SimpleUnitTestLibrary.Snapshot.h"
+#include "SimpleUnitTestLibrary.StaticRegistry.h"
 #include "SimpleUnitTestLibrary.Suite.h"
+#include "SimpleUnitTestLibrary.TestList.h"
+#include "SimpleUnitTestLibrary.Trace.h"
 #endif
 
 
 namespace SimpleUnitTestLibrary
 {
+    namespace Internal_
+    {
+        // Points the run's globals (read by Suite and async tests) at Runner::operator()'s locals, and clears them again
+        // however the run ends; declared after them, so it's destroyed first.
+        class ActiveRunScope
+        {
+        public:
+
+            ActiveRunScope(
+                _In_opt_ const std::vector<Reporter*>* const pReporters,
+                _In_opt_ const TestFilter* const pTestFilter,
+                _In_ EventLoop& eventLoop) noexcept
+            {
+                g_pActiveReporters.store(pReporters, std::memory_order_release);
+                g_pActiveTestFilter.store(pTestFilter, std::memory_order_release);
+                g_pActiveEventLoop.store(&eventLoop, std::memory_order_release);
+            }
+
+            ActiveRunScope(const ActiveRunScope&) = delete;
+            ActiveRunScope& operator=(const ActiveRunScope&) = delete;
+
+            ~ActiveRunScope() noexcept
+            {
+                g_pActiveEventLoop.store(nullptr, std::memory_order_release);
+                g_pActiveTestFilter.store(nullptr, std::memory_order_release);
+                g_pActiveReporters.store(nullptr, std::memory_order_release);
+            }
+        };
+
+        template <typename ReporterT>
+        void AddReporter(
+            _Inout_ std::vector<std::unique_ptr<Reporter>>& reporters,
+            _In_ const std::string_view filePathSV)
+        {
+            if (filePathSV.empty())
+            {
+                return;
+            }
+
+            auto pReporter{std::make_unique<ReporterT>(std::filesystem::path{filePathSV})};
+            if (!*pReporter)
+            {
+                Logger{}("Unable to create report file \"{}\"; skipping it.", filePathSV);
+                return;
+            }
+
+            reporters.push_back(std::move(pReporter));
+        }
+    }
+
+    // Runs every registered suite: each live Suite, then each suite registered with SUTL_REGISTER_STATIC_SUITE.
     struct [[nodiscard]] Runner
     {
+        // A single filter expression, e.g., SUTL::Runner{"Math"}; a plain name still selects suites by substring, as it always has.
+        // Selected alongside m_FilterSVs, as if it were one more of them.
         std::string_view m_SuiteNameFilterSV;
 
+        // Selects which suites/tests run (see TestFilter for the syntax); everything runs when empty.
+        std::vector<std::string_view> m_FilterSVs;
+
+        bool m_bUpdateSnapshots{false};
+        bool m_bPerfCounters{false};
+
+        // When set, the selected tests are printed (see ListFormat) instead of run, and no results are returned.
+        ListFormat m_ListFormat{ListFormat::None};
+
+        // Show a live progress line (done / total, failures, throughput, ETA) while suites run.
+        bool m_bProgress{false};
+
+        // Run suites, and the tests within each suite, in a random order (setup still first, cleanup still last)
+        // to surface hidden dependencies between tests. The seed is printed so a failing order can be reproduced.
+        bool m_bShuffle{false};
+        std::uint64_t m_ShuffleSeed{0}; // Zero means pick a random seed.
+
+        // Threads of the event loop that runs async tests (see AsyncTestGenerator); only started if any run.
+        std::uint32_t m_AsyncThreadCount{0}; // Zero means a few (up to 4).
+
+        // Set up this many upcoming suites ahead, each on a thread of its own, while the current suite's tests run, so slow
+        // setups (e.g., loading data sets) overlap with other suites' tests. Each holds what its setup acquired until
+        // it runs, which bounds the memory this costs. Zero sets each suite up just before its tests, as usual.
+        // A suite with SerialOnly tests is set up just before its tests, and runs with no other suite's setup running.
+        std::uint32_t m_SetupPipelineDepth{0};
+
+        // When set, a Chrome Trace Event JSON timeline of the run (a span per suite, setup, test, and cleanup) is written here.
+        std::string_view m_TraceFilePathSV;
+
+        // When set, results are streamed to these files as tests finish (JUnit XML / one JSON object per line).
+        std::string_view m_JUnitFilePathSV;
+        std::string_view m_JsonLinesFilePathSV;
+
+        // When set, a compact binary results file (see BinaryResults.h; read it with the sutl-results tool) is written here.
+        std::string_view m_BinaryResultsFilePathSV;
+
+        // Arguments FromCommandLine couldn't use (unknown options, malformed values), which it ignored; logged when the run starts.
+        std::vector<std::string> m_CommandLineErrorMessages;
+
+        // Recognized arguments:
+        //   --update-snapshots  Rewrite mismatched/missing snapshot goldens instead of failing.
+        //   --perf-counters     Measure hardware counters (cycles, instructions, cache/branch misses) per test.
+        //   --list[=json]       Print the selected tests (name, tags, source location) as text or JSON Lines instead of running them.
+        //   --progress          Show progress with an ETA (redrawn in place on a terminal, periodic lines otherwise).
+        //   --shuffle           Run suites and tests in a random order, printing the seed used.
+        //   --seed=<N>          Shuffle with seed <N> (implies --shuffle), e.g., to reproduce a shuffled run.
+        //   --async-threads=<N> Run async tests on <N> event loop threads.
+        //   --pipeline-setup=<N> Run the setups of up to <N> upcoming suites concurrently with the current suite's tests.
+        //   --trace=<file>      Write a Chrome trace (chrome://tracing, Perfetto UI) of the run to <file>.
+        //   --junit=<file>      Write a JUnit XML report of the run to <file>.
+        //   --jsonl=<file>      Write a JSON Lines report (a record per test and per suite) of the run to <file>.
+        //   --results=<file>    Write a binary results file (for merging/diffing shards with sutl-results) to <file>.
+        //   <filter>...         Non-option arguments; filter expressions, e.g., "Math*", "Math*/Add*,-*Slow*", "re:^Io.*/Read".
+        // Other "--" arguments, and options with malformed numbers, are ignored, and reported (see m_CommandLineErrorMessages).
+        [[nodiscard]] static constexpr Runner FromCommandLine(
+            _In_ const int argc,
+            _In_reads_(argc) const char* const argv[])
+        {
+            using namespace std::string_view_literals;
+
+            Runner runner;
+            for (int i = 1; i < argc; ++i)
+            {
+                const std::string_view argSV{argv[i]};
+                if (argSV == "--update-snapshots"sv)
+                {
+                    runner.m_bUpdateSnapshots = true;
+                }
+                else if (argSV == "--perf-counters"sv)
+                {
+                    runner.m_bPerfCounters = true;
+                }
+                else if ((argSV == "--list"sv) || (argSV == "--list=text"sv))
+                {
+                    runner.m_ListFormat = ListFormat::Text;
+                }
+                else if (argSV == "--list=json"sv)
+                {
+                    runner.m_ListFormat = ListFormat::Json;
+                }
+                else if (argSV == "--progress"sv)
+                {
+                    runner.m_bProgress = true;
+                }
+                else if (argSV == "--shuffle"sv)
+                {
+                    runner.m_bShuffle = true;
+                }
+                else if (argSV.starts_with("--seed="sv))
+                {
+                    const std::string_view seedSV{argSV.substr("--seed="sv.size())};
+                    std::uint64_t seed{0};
+                    const auto [pEnd, errc] = std::from_chars(seedSV.data(), seedSV.data() + seedSV.size(), seed);
+                    if ((errc == std::errc{}) && (pEnd == seedSV.data() + seedSV.size()))
+                    {
+                        runner.m_bShuffle = true;
+                        runner.m_ShuffleSeed = seed;
+                    }
+                    else
+                    {
+                        runner.m_CommandLineErrorMessages.push_back(std::format("Invalid value in \"{}\" (expected a number); ignoring it.", argSV));
+                    }
+                }
+                else if (argSV.starts_with("--async-threads="sv))
+                {
+                    const std::string_view threadCountSV{argSV.substr("--async-threads="sv.size())};
+                    std::uint32_t threadCount{0};
+                    const auto [pEnd, errc] = std::from_chars(threadCountSV.data(), threadCountSV.data() + threadCountSV.size(), threadCount);
+                    if ((errc == std::errc{}) && (pEnd == threadCountSV.data() + threadCountSV.size()))
+                    {
+                        runner.m_AsyncThreadCount = threadCount;
+                    }
+                    else
+                    {
+                        runner.m_CommandLineErrorMessages.push_back(std::format("Invalid value in \"{}\" (expected a number); ignoring it.", argSV));
+                    }
+                }
+                else if (argSV.starts_with("--pipeline-setup="sv))
+                {
+                    const std::string_view depthSV{argSV.substr("--pipeline-setup="sv.size())};
+                    std::uint32_t depth{0};
+                    const auto [pEnd, errc] = std::from_chars(depthSV.data(), depthSV.data() + depthSV.size(), depth);
+                    if ((errc == std::errc{}) && (pEnd == depthSV.data() + depthSV.size()))
+                    {
+                        runner.m_SetupPipelineDepth = depth;
+                    }
+                    else
+                    {
+                        runner.m_CommandLineErrorMessages.push_back(std::format("Invalid value in \"{}\" (expected a number); ignoring it.", argSV));
+                    }
+                }
+                else if (argSV.starts_with("--trace="sv))
+                {
+                    runner.m_TraceFilePathSV = argSV.substr("--trace="sv.size());
+                }
+                else if (argSV.starts_with("--junit="sv))
+                {
+                    runner.m_JUnitFilePathSV = argSV.substr("--junit="sv.size());
+                }
+                else if (argSV.starts_with("--jsonl="sv))
+                {
+                    runner.m_JsonLinesFilePathSV = argSV.substr("--jsonl="sv.size());
+                }
+                else if (argSV.starts_with("--results="sv))
+                {
+                    runner.m_BinaryResultsFilePathSV = argSV.substr("--results="sv.size());
+                }
+                else if (!argSV.starts_with("--"sv))
+                {
+                    runner.m_FilterSVs.push_back(argSV);
+                }
+                else
+                {
+                    runner.m_CommandLineErrorMessages.push_back(std::format("Unknown option \"{}\"; ignoring it.", argSV));
+                }
+            }
+
+            return runner;
+        }
+
         [[nodiscard]] constexpr std::vector<Suite::RunResults> operator()() const
         {
             std::vector<Suite::RunResults> runResults;
 
-            auto SuiteNameFilter = [this](const Suite* pSuite)
+            if not consteval
             {
-                auto Predicate = [](const char lhs, const char rhs)
+                Internal_::g_bUpdateSnapshots.store(m_bUpdateSnapshots, std::memory_order_relaxed);
+                Internal_::g_bPerfCountersEnabled.store(m_bPerfCounters, std::memory_order_relaxed);
+                Internal_::g_RunCounters.Reset();
+
+                for (const std::string& errorMessage : m_CommandLineErrorMessages)
                 {
-                    auto ToLower = [](const char c)
+                    Logger{}("{}", errorMessage);
+                }
+
+                std::vector<std::string_view> filterSVs{m_FilterSVs};
+                if (!m_SuiteNameFilterSV.empty())
+                {
+                    filterSVs.push_back(m_SuiteNameFilterSV);
+                }
+
+                const TestFilter testFilter{filterSVs};
+                for (const std::string& errorMessage : testFilter.GetErrorMessages())
+                {
+                    Logger{}("{}", errorMessage);
+                }
+
+                // Static suites are only built (and so allocate) once selected by name; constructed, they join the runtime registry
+                // until the run is over. Reserved up front, since the registry tracks each Suite's address.
+                std::vector<Suite> staticSuites;
+                std::size_t staticSuiteCount{0};
+                ForEachStaticSuite([&staticSuiteCount](_In_ const StaticSuiteDescriptor&) { ++staticSuiteCount; });
+                staticSuites.reserve(staticSuiteCount);
+                ForEachStaticSuite(
+                    [&staticSuites, &testFilter](_In_ const StaticSuiteDescriptor& staticSuiteDescriptor)
                     {
-                        if ('A' <= c && c <= 'Z')
+                        if (testFilter.SelectSuite(staticSuiteDescriptor.m_SuiteNameSV) != FilterSelection::None)
                         {
-                            return static_cast<char>(c | static_cast<char>(0x20));
+                            staticSuites.emplace_back(staticSuiteDescriptor);
                         }
+                    });
+
+                // Most suites are decided by name alone; the rest only run (setup, cleanup, and all) if any of their tests are selected.
+                std::vector<const Suite*> selectedSuites;
+                bool bFilterTests{false};
+                for (const Suite* const pSuite : Internal_::g_RuntimeSuiteRegistry)
+                {
+                    const FilterSelection filterSelection{testFilter.SelectSuite(pSuite->GetSuiteName())};
+                    if ((filterSelection == FilterSelection::All)
+                        || ((filterSelection == FilterSelection::PerTest) && pSuite->HasSelectedTests(testFilter)))
+                    {
+                        selectedSuites.push_back(pSuite);
+                        bFilterTests = bFilterTests || (filterSelection == FilterSelection::PerTest);
+                    }
+                }
+
+                if (m_ListFormat != ListFormat::None)
+                {
+                    WriteTestList(stdout, selectedSuites, testFilter, m_ListFormat);
+                    return runResults;
+                }
+
+                const std::uint64_t shuffleSeed{!m_bShuffle ? 0 : ((m_ShuffleSeed != 0) ? m_ShuffleSeed : Internal_::MakeRandomShuffleSeed())};
+                Internal_::g_bShuffleEnabled.store(m_bShuffle, std::memory_order_relaxed);
+                Internal_::g_ShuffleSeed.store(shuffleSeed, std::memory_order_relaxed);
+                if (m_bShuffle)
+                {
+                    Logger{}("Shuffling suites and tests with seed {} (rerun with --seed={} to reproduce this order).", shuffleSeed, shuffleSeed);
+                }
 
-                        return c;
+                // Shuffled runs list results in the order suites actually ran.
+                if (m_bShuffle)
+                {
+                    Internal_::ShuffleInPlace(selectedSuites, shuffleSeed);
+                }
+
+                std::optional<ProgressDisplay> progressDisplay;
+                if (m_bProgress)
+                {
+                    std::uint64_t totalTestCount{0};
+                    for (const Suite* const pSuite : selectedSuites)
+                    {
+                        totalTestCount += pSuite->GetTestCount(testFilter);
+                    }
+                    progressDisplay.emplace(totalTestCount);
+                }
+
+                std::vector<std::unique_ptr<Reporter>> reporters;
+                Internal_::AddReporter<TraceReporter>(reporters, m_TraceFilePathSV);
+                Internal_::AddReporter<JUnitReporter>(reporters, m_JUnitFilePathSV);
+                Internal_::AddReporter<JsonLinesReporter>(reporters, m_JsonLinesFilePathSV);
+                Internal_::AddReporter<BinaryResultsReporter>(reporters, m_BinaryResultsFilePathSV);
+
+                std::vector<Reporter*> reporterPtrs;
+                std::ranges::transform(reporters, std::back_inserter(reporterPtrs), &std::unique_ptr<Reporter>::get);
+
+                // One event loop for every suite's async tests; tests it abandoned (timed out) are destroyed along with it.
+                Internal_::EventLoop eventLoop{m_AsyncThreadCount};
+                const Internal_::ActiveRunScope activeRunScope{reporterPtrs.empty() ? nullptr : &reporterPtrs, bFilterTests ? &testFilter : nullptr, eventLoop};
+                if (m_SetupPipelineDepth == 0)
+                {
+                    for (const Suite* const pSuite : selectedSuites)
+                    {
+                        runResults.push_back((*pSuite)());
+                    }
+                }
+                else
+                {
+                    // Suite i + depth starts its setup as suite i starts running, so at most depth suites are ever
+                    // set up (or being set up) ahead of the one running.
+                    // A suite with SerialOnly tests runs alone: it sets itself up, as usual, once every setup already
+                    // started has finished, and no others start until it's done.
+                    std::vector<bool> serialOnlySuites;
+                    serialOnlySuites.reserve(selectedSuites.size());
+                    for (const Suite* const pSuite : selectedSuites)
+                    {
+                        serialOnlySuites.push_back(pSuite->HasSerialOnlyTests());
+                    }
+
+                    // Each started setup, with its suite's index in selectedSuites, in that order.
+                    std::deque<std::pair<std::size_t, std::future<void>>> pendingSetups;
+                    std::size_t nextSetupIndex{0};
+                    auto StartSetups = [&](_In_ const std::size_t endIndex)
+                    {
+                        for (; nextSetupIndex < endIndex; ++nextSetupIndex)
+                        {
+                            if (serialOnlySuites[nextSetupIndex])
+                            {
+                                continue;
+                            }
+
+                            // Without a thread to set it up ahead (RunSuiteSetup itself doesn't throw), the suite sets itself up as usual.
+                            const Suite* const pSuite{selectedSuites[nextSetupIndex]};
+                            try
+                            {
+                                pendingSetups.emplace_back(nextSetupIndex, std::async(std::launch::async, [pSuite]()
+                                {
+                                    const Internal_::ForkGateWorkScope forkGateWorkScope;
+                                    pSuite->RunSuiteSetup();
+                                }));
+                            }
+                            catch (const std::system_error&)
+                            {
+                            }
+                        }
                     };
-                    return ToLower(lhs) == ToLower(rhs);
-                };
-                return std::ranges::contains_subrange(
-                    pSuite->GetSuiteName(),
-                    m_SuiteNameFilterSV,
-                    Predicate);
-            };
-
-            auto filteredSuiteRefView{
-                Internal_::g_RuntimeSuiteRegistry
-                | std::views::filter(SuiteNameFilter)
-                | std::views::transform([](const Suite* pSuite) static constexpr -> const Suite& { return *pSuite; })};
-
-            for (const auto& suite : filteredSuiteRefView)
+
+                    const std::size_t depth{m_SetupPipelineDepth};
+                    for (std::size_t i = 0; i < selectedSuites.size(); ++i)
+                    {
+                        if (serialOnlySuites[i])
+                        {
+                            std::ranges::for_each(pendingSetups, [](_In_ const auto& pendingSetup) { pendingSetup.second.wait(); });
+                        }
+                        else
+                        {
+                            StartSetups(std::min(i + depth + 1, selectedSuites.size()));
+                            if (!pendingSetups.empty() && (pendingSetups.front().first == i))
+                            {
+                                pendingSetups.front().second.get();
+                                pendingSetups.pop_front();
+                            }
+                        }
+
+                        runResults.push_back((*selectedSuites[i])());
+                    }
+                }
+
+                // Reporters finish (and flush) their files, and the progress display prints its final tally, on destruction.
+                return runResults;
+            }
+
+            for (const Suite* const pSuite : Internal_::g_RuntimeSuiteRegistry)
             {
-                runResults.push_back(suite());
+                runResults.push_back((*pSuite)());
             }
+
             return runResults;
         }
     };
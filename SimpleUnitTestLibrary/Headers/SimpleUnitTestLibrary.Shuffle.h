@@ -0,0 +1,84 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "APIAnnotations.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Internal_
+    {
+        // Set by Runner (--shuffle / --seed=N) for the duration of a run.
+        inline constinit std::atomic<bool> g_bShuffleEnabled{false};
+        inline constinit std::atomic<std::uint64_t> g_ShuffleSeed{0};
+
+        [[nodiscard]] inline bool IsShuffleEnabled() noexcept
+        {
+            return g_bShuffleEnabled.load(std::memory_order_relaxed);
+        }
+
+        // Never zero, since a zero seed means "pick one" (like FuzzOptions::m_Seed).
+        [[nodiscard]] inline std::uint64_t MakeRandomShuffleSeed()
+        {
+            std::random_device randomDevice;
+            const std::uint64_t seed{(static_cast<std::uint64_t>(randomDevice()) << 32) | randomDevice()};
+            return (seed != 0) ? seed : 1;
+        }
+
+        // Derives an independent seed per name (e.g., per suite), so a suite's test order depends only on
+        // the run seed and its own name - not on which other suites were filtered in or what order they ran in.
+        [[nodiscard]] constexpr std::uint64_t MixShuffleSeed(
+            _In_ const std::uint64_t seed,
+            _In_ const std::string_view nameSV) noexcept
+        {
+            // FNV-1a
+            std::uint64_t hash{0xCBF29CE484222325ull};
+            for (const char c : nameSV)
+            {
+                hash = (hash ^ static_cast<std::uint8_t>(c)) * 0x100000001B3ull;
+            }
+
+            return seed ^ hash;
+        }
+
+        // Fisher-Yates over mt19937_64 (whose output is fully specified) rather than std::shuffle (whose use of the
+        // engine is implementation-defined), so a seed reproduces the same order with every standard library.
+        template <std::ranges::random_access_range RangeT>
+        void ShuffleInPlace(
+            _Inout_ RangeT&& range,
+            _In_ const std::uint64_t seed)
+        {
+            std::mt19937_64 rng{seed};
+            const auto size{std::ranges::size(range)};
+            for (auto i = size; i > 1; --i)
+            {
+                using std::swap;
+                swap(range[i - 1], range[static_cast<decltype(size)>(rng() % i)]);
+            }
+        }
+
+        // A shuffled 0..count-1, e.g., to run generated tests in a random order without materializing them.
+        [[nodiscard]] inline std::vector<std::size_t> MakeShuffledIndices(
+            _In_ const std::size_t count,
+            _In_ const std::uint64_t seed)
+        {
+            std::vector<std::size_t> indices(count);
+            std::iota(indices.begin(), indices.end(), std::size_t{0});
+            ShuffleInPlace(indices, seed);
+            return indices;
+        }
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,234 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.MappedFile.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    namespace Internal_
+    {
+        // Set by Runner (--update-snapshots); when true, mismatched or missing goldens are rewritten instead of failing.
+        inline constinit std::atomic<bool> g_bUpdateSnapshots{false};
+
+        // Writes bytes to a temporary file next to path, flushes it to disk, then renames it over path,
+        // so readers only ever see the old or the new golden - never a partial one.
+        [[nodiscard]] inline std::error_code WriteFileAtomically(
+            _In_ const std::filesystem::path& path,
+            _In_ const std::span<const std::byte> bytes) noexcept
+        {
+            std::error_code ec;
+            if (path.has_parent_path())
+            {
+                std::filesystem::create_directories(path.parent_path(), ec);
+                if (ec)
+                {
+                    return ec;
+                }
+            }
+
+            std::filesystem::path tempPath{path};
+            tempPath += ".sutl-tmp";
+
+#if defined(_WIN32)
+            const HANDLE hFile{::CreateFileW(tempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr)};
+            if (hFile == INVALID_HANDLE_VALUE)
+            {
+                return std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+            }
+
+            for (std::size_t offset = 0; !ec && (offset < bytes.size());)
+            {
+                DWORD bytesWritten{0};
+                const DWORD chunkSize{static_cast<DWORD>(std::min<std::size_t>(bytes.size() - offset, 1u << 30))};
+                if (!::WriteFile(hFile, bytes.data() + offset, chunkSize, &bytesWritten, nullptr))
+                {
+                    ec = std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+                }
+                offset += bytesWritten;
+            }
+            if (!ec && !::FlushFileBuffers(hFile))
+            {
+                ec = std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+            }
+            ::CloseHandle(hFile);
+
+            if (!ec && !::MoveFileExW(tempPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+            {
+                ec = std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+            }
+#else
+            const int fd{::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+            if (fd < 0)
+            {
+                return std::error_code{errno, std::system_category()};
+            }
+
+            for (std::size_t offset = 0; !ec && (offset < bytes.size());)
+            {
+                const auto bytesWritten{::write(fd, bytes.data() + offset, bytes.size() - offset)};
+                if (bytesWritten < 0)
+                {
+                    if (errno != EINTR)
+                    {
+                        ec = std::error_code{errno, std::system_category()};
+                    }
+                    continue;
+                }
+                offset += static_cast<std::size_t>(bytesWritten);
+            }
+            if (!ec && (::fsync(fd) != 0))
+            {
+                ec = std::error_code{errno, std::system_category()};
+            }
+            ::close(fd);
+
+            if (!ec && (::rename(tempPath.c_str(), path.c_str()) != 0))
+            {
+                ec = std::error_code{errno, std::system_category()};
+            }
+#endif
+
+            if (ec)
+            {
+                std::error_code ignored;
+                std::filesystem::remove(tempPath, ignored);
+            }
+
+            return ec;
+        }
+
+        // Offset of the first differing byte, or the shorter size if one is a prefix of the other.
+        // Compares a page at a time with memcmp, and only walks bytes inside the differing page.
+        [[nodiscard]] inline std::size_t FindFirstDifference(
+            _In_ const std::span<const std::byte> expected,
+            _In_ const std::span<const std::byte> actual) noexcept
+        {
+            constexpr std::size_t cBlockSize{4096};
+            const std::size_t commonSize{std::min(expected.size(), actual.size())};
+
+            std::size_t offset{0};
+            while ((offset < commonSize) &&
+                (std::memcmp(expected.data() + offset, actual.data() + offset, std::min(cBlockSize, commonSize - offset)) == 0))
+            {
+                offset += cBlockSize;
+            }
+
+            if (offset >= commonSize)
+            {
+                return commonSize;
+            }
+
+            const auto blockEnd{std::min(offset + cBlockSize, commonSize)};
+            const auto [pExpected, pActual]{std::mismatch(expected.data() + offset, expected.data() + blockEnd, actual.data() + offset)};
+            return static_cast<std::size_t>(pExpected - expected.data());
+        }
+    }
+
+    [[nodiscard]] inline bool IsUpdatingSnapshots() noexcept
+    {
+        return Internal_::g_bUpdateSnapshots.load(std::memory_order_relaxed);
+    }
+
+    // Unconditionally (and atomically) rewrites the golden file.
+    [[nodiscard]] inline Result UpdateSnapshot(
+        _In_ const std::filesystem::path& goldenPath,
+        _In_ const std::span<const std::byte> actual,
+        _In_ const std::source_location srcLoc = std::source_location::current())
+    {
+        if (const std::error_code ec{Internal_::WriteFileAtomically(goldenPath, actual)}; ec)
+        {
+            return Result{
+                ResultType::TestFailure,
+                srcLoc,
+                std::format("Unable to update snapshot \"{}\": {}", goldenPath.string(), ec.message())};
+        }
+
+        return Result{ResultType::Success, srcLoc, std::format("Updated snapshot \"{}\"", goldenPath.string())};
+    }
+
+    // Compares actual against the golden file (memory-mapped, never copied).
+    // In update mode (Runner::m_bUpdateSnapshots / --update-snapshots), a missing or different golden is rewritten instead.
+    [[nodiscard]] inline Result CompareSnapshot(
+        _In_ const std::filesystem::path& goldenPath,
+        _In_ const std::span<const std::byte> actual,
+        _In_ const std::source_location srcLoc = std::source_location::current())
+    {
+        std::string mismatchInfo;
+        {
+            const MappedFile golden{goldenPath};
+            if (!golden)
+            {
+                mismatchInfo = std::format(
+                    "Unable to map snapshot \"{}\": {} (run with --update-snapshots to create it)",
+                    goldenPath.string(), golden.GetErrorCode().message());
+            }
+            else if ((golden.size() == actual.size()) && (actual.empty() || (std::memcmp(golden.data(), actual.data(), actual.size()) == 0)))
+            {
+                return Result{ResultType::Success, srcLoc};
+            }
+            else
+            {
+                const std::size_t offset{Internal_::FindFirstDifference(golden.GetBytes(), actual)};
+                auto ByteAt = [offset](_In_ const std::span<const std::byte> bytes) -> std::string
+                {
+                    return (offset < bytes.size())
+                        ? std::format("0x{:02x}", static_cast<std::uint8_t>(bytes[offset]))
+                        : std::string{"<end>"};
+                };
+
+                mismatchInfo = std::format(
+                    "Snapshot \"{}\" differs at offset {} (expected {}, actual {}; expected size {}, actual size {})",
+                    goldenPath.string(), offset, ByteAt(golden.GetBytes()), ByteAt(actual), golden.size(), actual.size());
+            }
+        }
+
+        // The mapping is released above, so the golden can be replaced (required on Windows).
+        if (IsUpdatingSnapshots())
+        {
+            return UpdateSnapshot(goldenPath, actual, srcLoc);
+        }
+
+        return Result{ResultType::TestFailure, srcLoc, std::move(mismatchInfo)};
+    }
+
+    [[nodiscard]] inline Result CompareSnapshot(
+        _In_ const std::filesystem::path& goldenPath,
+        _In_ const std::string_view actual,
+        _In_ const std::source_location srcLoc = std::source_location::current())
+    {
+        return CompareSnapshot(goldenPath, std::as_bytes(std::span{actual}), srcLoc);
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,97 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <source_location>
+#include <span>
+#include <string_view>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Tags.h"
+#include "SimpleUnitTestLibrary.Test.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // A unit test, described entirely by constants (see SUTL_STATIC_UNIT_TEST).
+    struct StaticTestDescriptor
+    {
+        std::string_view m_TestNameSV;
+        TestFunction m_TestFn{};
+        TestTags m_Tags{};
+        std::source_location m_SourceLocation{std::source_location::current()};
+    };
+
+    // A suite, described entirely by constants, so it can be registered (SUTL_REGISTER_STATIC_SUITE) without a global
+    // constructor: nothing runs or allocates at startup, and a Suite is only built from it when Runner selects it.
+    struct StaticSuiteDescriptor
+    {
+        std::string_view m_SuiteNameSV;
+        std::span<const StaticTestDescriptor> m_TestDescriptors;
+        TestFunction m_SuiteSetupFn{};
+        TestFunction m_SuiteCleanupFn{};
+    };
+
+    namespace Internal_
+    {
+        // SUTL_REGISTER_STATIC_SUITE places a pointer to each descriptor in a dedicated linker section, and the linker
+        // gathers them from every object file into one array, bounded here.
+        //   MSVC:   "sutl$m" entries are merged, sorted by the name after '$', between the "sutl$a" and "sutl$z" sentinels.
+        //           Incremental linking may pad the section with zeros, hence the null entries.
+        //   ELF:    The linker defines __start_/__stop_ symbols for sections named like C identifiers. They're weak,
+        //           so a program without static suites still links (with both null).
+        //   Mach-O: The linker's section$start/section$end symbols.
+#if defined(_MSC_VER)
+#pragma section("sutl$a", read)
+#pragma section("sutl$z", read)
+
+        __declspec(allocate("sutl$a")) inline const StaticSuiteDescriptor* const g_cpStaticSuiteSectionBegin{nullptr};
+        __declspec(allocate("sutl$z")) inline const StaticSuiteDescriptor* const g_cpStaticSuiteSectionEnd{nullptr};
+
+        [[nodiscard]] inline std::span<const StaticSuiteDescriptor* const> GetStaticSuiteSection() noexcept
+        {
+            return {&g_cpStaticSuiteSectionBegin + 1, &g_cpStaticSuiteSectionEnd};
+        }
+#elif defined(__APPLE__)
+        extern const StaticSuiteDescriptor* const g_cpStaticSuiteSectionBegin[] __asm("section$start$__DATA$sutl_suites");
+        extern const StaticSuiteDescriptor* const g_cpStaticSuiteSectionEnd[] __asm("section$end$__DATA$sutl_suites");
+
+        [[nodiscard]] inline std::span<const StaticSuiteDescriptor* const> GetStaticSuiteSection() noexcept
+        {
+            return {g_cpStaticSuiteSectionBegin, g_cpStaticSuiteSectionEnd};
+        }
+#else
+        extern "C" __attribute__((weak)) const StaticSuiteDescriptor* const __start_sutl_suites[];
+        extern "C" __attribute__((weak)) const StaticSuiteDescriptor* const __stop_sutl_suites[];
+
+        [[nodiscard]] inline std::span<const StaticSuiteDescriptor* const> GetStaticSuiteSection() noexcept
+        {
+            if (__start_sutl_suites == nullptr)
+            {
+                return {};
+            }
+
+            return {__start_sutl_suites, __stop_sutl_suites};
+        }
+#endif
+    }
+
+    // Every suite registered with SUTL_REGISTER_STATIC_SUITE in the program, in link order.
+    // Reading it does no work beyond skipping linker padding; there's nothing to initialize.
+    template <std::invocable<const StaticSuiteDescriptor&> VisitFnT>
+    void ForEachStaticSuite(_Inout_ VisitFnT&& visitFn)
+    {
+        for (const StaticSuiteDescriptor* const pDescriptor : Internal_::GetStaticSuiteSection())
+        {
+            if (pDescriptor != nullptr)
+            {
+                std::invoke(visitFn, *pDescriptor);
+            }
+        }
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
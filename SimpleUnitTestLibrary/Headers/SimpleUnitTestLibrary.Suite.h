@@ -2,19 +2,29 @@
 
 #if !defined(SUTL_USE_MODULES)
 #include <algorithm>
+#include <array>
 #include <concepts>
 #include <cstdint>
+#include <exception>
 #include <format>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <ranges>
+#include <source_location>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Filter.h"
 #include "SimpleUnitTestLibrary.Test.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Shuffle.h"
+#include "SimpleUnitTestLibrary.StaticRegistry.h"
 #endif
 
 namespace SimpleUnitTestLibrary
@@ -51,6 +61,7 @@ R"(
       Test:       {}
       Cleanup:    {}
       Exceptions: {}
+      Leaks:      {}
 )"sv
         };
     }
@@ -79,8 +90,66 @@ namespace SimpleUnitTestLibrary
     {
     private:
 
+        // The suite's tests (suite setup first and cleanup last, when present) as parallel arrays, split by how often
+        // they're touched: deciding whether each test still has to run, and counting it, only reads its function and
+        // result type, so those are packed densely, away from the names, tags, locations, and full results that only
+        // filtering, listing, reporting, and building RunResults read. A test that passes with nothing to report (no
+        // info, no measurements, no active reporters) only records its result type; see GetUnitTestResult.
+        // SuiteLayoutBenchmark measures the difference on large suites of trivial tests.
+        struct UnitTestTable
+        {
+            // Hot
+            std::vector<TestFunction> m_TestFns;
+            mutable std::vector<ResultType> m_ResultTypes;
+
+            // Cold
+            std::vector<Internal_::ArenaString> m_TestNames;
+            std::vector<TestTags> m_TestTags;
+            std::vector<std::source_location> m_SourceLocations;
+            mutable std::vector<Result> m_Results;
+
+            // When Suite::RunSuiteSetup ran suite setup ahead of the suite, so it's reported as having run then.
+            mutable std::uint64_t m_SetupBeginNs{0};
+            mutable std::uint64_t m_SetupEndNs{0};
+
+            [[nodiscard]] constexpr std::size_t size() const noexcept
+            {
+                return m_TestFns.size();
+            }
+
+            constexpr void reserve(_In_ const std::size_t testCount)
+            {
+                m_TestFns.reserve(testCount);
+                m_ResultTypes.reserve(testCount);
+                m_TestNames.reserve(testCount);
+                m_TestTags.reserve(testCount);
+                m_SourceLocations.reserve(testCount);
+                m_Results.reserve(testCount);
+            }
+
+            constexpr void push_back(
+                _Inout_ Internal_::ArenaString&& testName,
+                _In_ const TestFunction testFn,
+                _In_ const TestTags tags,
+                _In_ const std::source_location& srcLoc,
+                _Inout_ Result&& result)
+            {
+                m_TestFns.push_back(testFn);
+                m_ResultTypes.push_back(result.m_ResultType);
+                m_TestNames.push_back(std::move(testName));
+                m_TestTags.push_back(tags);
+                m_SourceLocations.push_back(srcLoc);
+                m_Results.push_back(std::move(result));
+            }
+        };
+
+        // Holds the names of m_UnitTests (declared first, so it outlives them), so building a suite's tests takes
+        // a few large allocations rather than one per name.
+        std::unique_ptr<Internal_::StringArena> m_pNameArena;
+
         std::string m_SuiteName;
-        std::vector<Test> m_UnitTests;
+        UnitTestTable m_UnitTests;
+        std::vector<std::unique_ptr<const TestGenerator>> m_TestGenerators;
 
         TestFunction m_SuiteSetupFn;
         TestFunction m_SuiteCleanupFn;
@@ -90,6 +159,129 @@ namespace SimpleUnitTestLibrary
             return std::ranges::find(Internal_::g_RuntimeSuiteRegistry | std::views::reverse, this);
         }
 
+        // Reserves room for the unit tests, and adds suite setup; called before the unit tests are added.
+        constexpr void BeginUnitTests(_In_ const std::size_t unitTestCount)
+        {
+            m_pNameArena = Internal_::MakeStringArena(Internal_::EstimateStringArenaSize(2 + unitTestCount));
+            m_UnitTests.reserve(!!m_SuiteSetupFn + unitTestCount + !!m_SuiteCleanupFn);
+            if (!!m_SuiteSetupFn)
+            {
+                AddStageTest("(Setup)", m_SuiteSetupFn);
+            }
+        }
+
+        constexpr void AddUnitTest(
+            _In_ const std::string_view testNameSV,
+            _In_ const TestFunction testFn,
+            _In_ const TestTags tags,
+            _In_ const std::source_location& srcLoc,
+            _Inout_ Result&& result = {})
+        {
+            m_UnitTests.push_back(Internal_::ArenaString{testNameSV, Internal_::GetArenaAllocator(m_pNameArena)}, testFn, tags, srcLoc, std::move(result));
+        }
+
+        constexpr void AddStageTest(
+            _In_ const std::string_view stageSV,
+            _In_ const TestFunction stageFn)
+        {
+            Internal_::ArenaString testName{Internal_::GetArenaAllocator(m_pNameArena)};
+            testName.reserve(m_SuiteName.size() + stageSV.size());
+            testName.append(m_SuiteName).append(stageSV);
+            m_UnitTests.push_back(std::move(testName), stageFn, TestTags{}, std::source_location::current(), Result{});
+        }
+
+        // Adds suite cleanup, and registers the suite; called once all of the unit tests have been added.
+        constexpr void EndUnitTests()
+        {
+            if (!!m_SuiteCleanupFn)
+            {
+                AddStageTest("(Cleanup)", m_SuiteCleanupFn);
+            }
+
+            if not consteval
+            {
+                Internal_::g_RuntimeSuiteRegistry.push_back(this);
+            }
+        }
+
+        // The unit test at testIndex (with its latest result), named by nameAllocator; e.g., for RunResults.
+        [[nodiscard]] constexpr Test MakeTest(
+            _In_ const std::size_t testIndex,
+            _In_ const Internal_::ArenaAllocator<char>& nameAllocator) const
+        {
+            Test test{
+                Internal_::ArenaString{m_UnitTests.m_TestNames[testIndex], nameAllocator},
+                m_UnitTests.m_TestFns[testIndex],
+                m_UnitTests.m_TestTags[testIndex],
+                m_UnitTests.m_SourceLocations[testIndex]};
+            test.m_Result = GetUnitTestResult(testIndex);
+            return test;
+        }
+
+        // The latest result of the unit test at testIndex. One that passed with nothing to report was never stored (see
+        // UnitTestTable), so it's rebuilt here, located at the test itself.
+        [[nodiscard]] constexpr Result GetUnitTestResult(_In_ const std::size_t testIndex) const
+        {
+            if ((m_UnitTests.m_ResultTypes[testIndex] == ResultType::Success) && (m_UnitTests.m_Results[testIndex].m_ResultType == ResultType::NotRun))
+            {
+                return Result{ResultType::Success, m_UnitTests.m_SourceLocations[testIndex]};
+            }
+
+            return m_UnitTests.m_Results[testIndex];
+        }
+
+        // Copies (or, from an rvalue range, moves) each test into tests, with its name stored by nameAllocator.
+        template <typename RangeT>
+        static constexpr void AppendTests(
+            _Inout_ std::vector<Test>& tests,
+            _Inout_ RangeT&& sourceTests,
+            _In_ const Internal_::ArenaAllocator<char>& nameAllocator)
+        {
+            for (auto&& test : sourceTests)
+            {
+                if constexpr (std::is_lvalue_reference_v<RangeT>)
+                {
+                    tests.push_back(Test{std::as_const(test), nameAllocator});
+                }
+                else
+                {
+                    tests.push_back(Test{std::move(test), nameAllocator});
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr std::size_t GetBodyBegin() const noexcept
+        {
+            return !!m_SuiteSetupFn;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetBodyEnd() const noexcept
+        {
+            return m_UnitTests.size() - !!m_SuiteCleanupFn;
+        }
+
+        [[nodiscard]] bool IsUnitTestSelected(
+            _In_ const TestFilter& testFilter,
+            _In_ const std::size_t testIndex) const
+        {
+            return testFilter.IsTestSelected(m_SuiteName, m_UnitTests.m_TestNames[testIndex], m_UnitTests.m_TestTags[testIndex]);
+        }
+
+        // A test that otherwise passed, but left heap memory behind, fails as a leak.
+        // Suite setup/cleanup are exempt: setup's allocations are expected to outlive it.
+        static constexpr void CheckForLeaks(_Inout_ Result& result)
+        {
+            const AllocationStats& allocationStats{result.GetAllocationStats()};
+            if ((result.m_ResultType == ResultType::Success) && allocationStats.HasLeaks())
+            {
+                result.m_ResultType = ResultType::LeakFailure;
+                result.m_Info = std::format("Leaked {} bytes ({} allocations, {} frees)",
+                    allocationStats.m_NetLiveBytes,
+                    allocationStats.m_AllocationCount,
+                    allocationStats.m_DeallocationCount);
+            }
+        }
+
     public:
 
         static_assert(std::is_pointer_v<TestFunction>, "SAL needs updating");
@@ -103,21 +295,46 @@ namespace SimpleUnitTestLibrary
             m_SuiteSetupFn{suiteSetupFn},
             m_SuiteCleanupFn{suiteCleanupFn}
         {
-            m_UnitTests.reserve(!!suiteSetupFn + std::ranges::size(unitTests) + !!suiteCleanupFn);
-            if (!!suiteSetupFn)
-            {
-                m_UnitTests.emplace_back(m_SuiteName + "(Setup)", suiteSetupFn);
-            }
-            m_UnitTests.append_range(std::forward<UnitTestRangeT>(unitTests));
-            if (!!suiteCleanupFn)
+            BeginUnitTests(std::ranges::size(unitTests));
+            for (auto&& unitTest : unitTests)
             {
-                m_UnitTests.emplace_back(m_SuiteName + "(Cleanup)", suiteCleanupFn);
+                const Test& test{unitTest};
+                if constexpr (std::is_lvalue_reference_v<UnitTestRangeT>)
+                {
+                    AddUnitTest(test.GetTestName(), test.m_TestFn, test.m_Tags, test.m_SourceLocation, Result{test.m_Result});
+                }
+                else
+                {
+                    AddUnitTest(test.GetTestName(), test.m_TestFn, test.m_Tags, test.m_SourceLocation, std::move(test.m_Result));
+                }
             }
+            EndUnitTests();
+        }
 
-            if not consteval
+        // A lazy suite: its tests come from testGenerator (e.g., MakeLazyTests) as the suite runs, rather than
+        // being built up front, so a suite of millions of tests costs next to nothing until (and unless) it's selected.
+        constexpr Suite(
+            _In_ const std::string_view suiteNameSV,
+            _Inout_ std::unique_ptr<const TestGenerator> pTestGenerator,
+            _In_opt_ const TestFunction suiteSetupFn = TestFunction{},
+            _In_opt_ const TestFunction suiteCleanupFn = TestFunction{}) :
+            Suite{suiteNameSV, std::array<Test, 0>{}, suiteSetupFn, suiteCleanupFn}
+        {
+            AddTestGenerator(std::move(pTestGenerator));
+        }
+
+        // Builds (and registers) the suite a StaticSuiteDescriptor describes; Runner does so for each selected static suite.
+        constexpr explicit Suite(_In_ const StaticSuiteDescriptor& staticSuiteDescriptor) :
+            m_SuiteName{staticSuiteDescriptor.m_SuiteNameSV},
+            m_SuiteSetupFn{staticSuiteDescriptor.m_SuiteSetupFn},
+            m_SuiteCleanupFn{staticSuiteDescriptor.m_SuiteCleanupFn}
+        {
+            BeginUnitTests(staticSuiteDescriptor.m_TestDescriptors.size());
+            for (const StaticTestDescriptor& testDescriptor : staticSuiteDescriptor.m_TestDescriptors)
             {
-                Internal_::g_RuntimeSuiteRegistry.push_back(this);
+                AddUnitTest(testDescriptor.m_TestNameSV, testDescriptor.m_TestFn, testDescriptor.m_Tags, testDescriptor.m_SourceLocation);
             }
+            EndUnitTests();
         }
 
         // No copy
@@ -125,8 +342,10 @@ namespace SimpleUnitTestLibrary
         Suite& operator=(const Suite&) = delete;
 
         constexpr Suite(_Inout_ Suite&& other) noexcept :
+            m_pNameArena{std::move(other.m_pNameArena)},
             m_SuiteName{std::move(other.m_SuiteName)},
             m_UnitTests{std::move(other.m_UnitTests)},
+            m_TestGenerators{std::move(other.m_TestGenerators)},
             m_SuiteSetupFn{std::move(other.m_SuiteSetupFn)},
             m_SuiteCleanupFn{std::move(other.m_SuiteCleanupFn)}
         {
@@ -146,6 +365,8 @@ namespace SimpleUnitTestLibrary
             {
                 m_SuiteName = std::move(other.m_SuiteName);
                 m_UnitTests = std::move(other.m_UnitTests);
+                m_pNameArena = std::move(other.m_pNameArena); // Only once the tests named from the old arena are gone.
+                m_TestGenerators = std::move(other.m_TestGenerators);
                 m_SuiteSetupFn = std::move(other.m_SuiteSetupFn);
                 m_SuiteCleanupFn = std::move(other.m_SuiteCleanupFn);
 
@@ -179,24 +400,323 @@ namespace SimpleUnitTestLibrary
             return m_SuiteName;
         }
 
+        // Every test the suite will account for when run: suite setup/cleanup, unit tests, and generated tests.
+        [[nodiscard]] constexpr std::uint64_t GetTestCount() const noexcept
+        {
+            std::uint64_t testCount{m_UnitTests.size()};
+            for (const auto& pTestGenerator : m_TestGenerators)
+            {
+                testCount += pTestGenerator->GetTestCount();
+            }
+
+            return testCount;
+        }
+
+        // As above, but only counting the tests testFilter selects (suite setup/cleanup always run with any selected test).
+        [[nodiscard]] std::uint64_t GetTestCount(_In_ const TestFilter& testFilter) const
+        {
+            switch (testFilter.SelectSuite(m_SuiteName))
+            {
+                case FilterSelection::None:
+                    return 0;
+
+                case FilterSelection::All:
+                    return GetTestCount();
+
+                case FilterSelection::PerTest:
+                default:
+                    break;
+            }
+
+            std::uint64_t testCount{static_cast<std::uint64_t>(!!m_SuiteSetupFn + !!m_SuiteCleanupFn)};
+            for (std::size_t i = GetBodyBegin(); i < GetBodyEnd(); ++i)
+            {
+                testCount += IsUnitTestSelected(testFilter, i) ? 1 : 0;
+            }
+
+            std::string testName;
+            for (const auto& pTestGenerator : m_TestGenerators)
+            {
+                for (std::size_t i = 0; i < pTestGenerator->GetTestCount(); ++i)
+                {
+                    pTestGenerator->FormatTestName(i, testName);
+                    testCount += testFilter.IsTestSelected(m_SuiteName, testName, pTestGenerator->GetTestTags(i)) ? 1 : 0;
+                }
+            }
+
+            return testCount;
+        }
+
+        // Whether testFilter selects any of the suite's unit or generated tests (not counting suite setup/cleanup).
+        [[nodiscard]] bool HasSelectedTests(_In_ const TestFilter& testFilter) const
+        {
+            switch (testFilter.SelectSuite(m_SuiteName))
+            {
+                case FilterSelection::None:
+                    return false;
+
+                case FilterSelection::All:
+                    return true;
+
+                case FilterSelection::PerTest:
+                default:
+                    break;
+            }
+
+            for (std::size_t i = GetBodyBegin(); i < GetBodyEnd(); ++i)
+            {
+                if (IsUnitTestSelected(testFilter, i))
+                {
+                    return true;
+                }
+            }
+
+            std::string testName;
+            for (const auto& pTestGenerator : m_TestGenerators)
+            {
+                for (std::size_t i = 0; i < pTestGenerator->GetTestCount(); ++i)
+                {
+                    pTestGenerator->FormatTestName(i, testName);
+                    if (testFilter.IsTestSelected(m_SuiteName, testName, pTestGenerator->GetTestTags(i)))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        // Calls visitFn(testName, tags, sourceLocation) for each unit and generated test (not suite setup/cleanup) that testFilter
+        // selects, in the order they're declared, without running any. Generated tests have no source location.
+        template <std::invocable<std::string_view, TestTags, const std::source_location&> VisitFnT>
+        void VisitSelectedTests(
+            _In_ const TestFilter& testFilter,
+            _Inout_ VisitFnT&& visitFn) const
+        {
+            const FilterSelection filterSelection{testFilter.SelectSuite(m_SuiteName)};
+            if (filterSelection == FilterSelection::None)
+            {
+                return;
+            }
+
+            const bool bFilterTests{filterSelection == FilterSelection::PerTest};
+            for (std::size_t i = GetBodyBegin(); i < GetBodyEnd(); ++i)
+            {
+                if (!bFilterTests || IsUnitTestSelected(testFilter, i))
+                {
+                    std::invoke(visitFn, std::string_view{m_UnitTests.m_TestNames[i]}, m_UnitTests.m_TestTags[i], m_UnitTests.m_SourceLocations[i]);
+                }
+            }
+
+            constexpr std::source_location cNoSourceLocation;
+            std::string testName;
+            for (const auto& pTestGenerator : m_TestGenerators)
+            {
+                const std::size_t testCount{pTestGenerator->GetTestCount()};
+                for (std::size_t i = 0; i < testCount; ++i)
+                {
+                    pTestGenerator->FormatTestName(i, testName);
+                    const TestTags testTags{pTestGenerator->GetTestTags(i)};
+                    if (!bFilterTests || testFilter.IsTestSelected(m_SuiteName, testName, testTags))
+                    {
+                        std::invoke(visitFn, std::string_view{testName}, testTags, cNoSourceLocation);
+                    }
+                }
+            }
+        }
+
+        // Generated tests run after the suite's unit tests, and before suite cleanup.
+        constexpr Suite& AddTestGenerator(_Inout_ std::unique_ptr<const TestGenerator> pTestGenerator)
+        {
+            if (!!pTestGenerator)
+            {
+                m_TestGenerators.push_back(std::move(pTestGenerator));
+            }
+
+            return *this;
+        }
+
+        // Runs suite setup (if there is one, and it hasn't run) ahead of operator(), which then goes by its result (and
+        // reports its timing) as if it had just run it; e.g., Runner sets upcoming suites up on other threads while
+        // earlier suites run. A setup that throws fails as an UnhandledException. Nothing else may use this Suite until it returns.
+        void RunSuiteSetup() const
+        {
+            if (!!m_SuiteSetupFn && (m_UnitTests.m_ResultTypes[0] == ResultType::NotRun))
+            {
+                Result& result{m_UnitTests.m_Results[0]};
+                m_UnitTests.m_SetupBeginNs = Internal_::GetTimestampNs();
+                try
+                {
+                    result = Internal_::InvokeInstrumentedTest(m_SuiteSetupFn);
+                }
+                catch (const std::exception& e)
+                {
+                    result = Result{ResultType::UnhandledException, m_UnitTests.m_SourceLocations[0], std::format("Suite setup threw: {}", e.what())};
+                }
+                catch (...)
+                {
+                    result = Result{ResultType::UnhandledException, m_UnitTests.m_SourceLocations[0], "Suite setup threw: Unknown exception"};
+                }
+
+                m_UnitTests.m_SetupEndNs = Internal_::GetTimestampNs();
+                m_UnitTests.m_ResultTypes[0] = result.m_ResultType;
+            }
+        }
+
+        // Whether any of its tests (unit or generated) is tagged SerialOnly; Runner doesn't set other suites up while it runs.
+        [[nodiscard]] bool HasSerialOnlyTests() const
+        {
+            auto IsSerialOnly = [](_In_ const TestTags tags) { return tags.Contains(Tag::SerialOnly); };
+            if (std::ranges::any_of(m_UnitTests.m_TestTags, IsSerialOnly))
+            {
+                return true;
+            }
+
+            return std::ranges::any_of(m_TestGenerators,
+                [&IsSerialOnly](_In_ const std::unique_ptr<const TestGenerator>& pTestGenerator)
+                {
+                    const std::size_t testCount{pTestGenerator->GetTestCount()};
+                    for (std::size_t i = 0; i < testCount; ++i)
+                    {
+                        if (IsSerialOnly(pTestGenerator->GetTestTags(i)))
+                        {
+                            return true;
+                        }
+                    }
+
+                    return false;
+                });
+        }
+
         struct RunResults
         {
+        private:
+
+            // Holds the names of m_UnitTests (declared first, so it outlives them). Tests copied out of a RunResults are
+            // heap-backed, but ones moved out must not outlive it.
+            std::unique_ptr<Internal_::StringArena> m_pNameArena;
+
+            friend class Suite;
+
+            // For Suite, which adds the (up to testCount) tests itself.
+            constexpr RunResults(
+                _In_ const std::string_view originSuiteNameSV,
+                _In_ const ResultTypeCounts& resultTypeCounts,
+                _In_ const std::size_t testCount) :
+                m_pNameArena{Internal_::MakeStringArena(Internal_::EstimateStringArenaSize(testCount))},
+                m_OriginSuiteNameSV{originSuiteNameSV},
+                m_ResultTypeCounts{resultTypeCounts}
+            {
+                m_UnitTests.reserve(testCount);
+            }
+
+        public:
+
             std::string m_OriginSuiteNameSV;
             std::vector<Test> m_UnitTests;
 
+            // Every test in the suite, tallied as each one completed. Generated tests are only listed in m_UnitTests
+            // when they need attention (i.e., not successful), so this is the only complete record of them.
+            ResultTypeCounts m_ResultTypeCounts{};
+
+            // Sum over every test that ran (listed or not); only measured when perf counters are enabled.
+            PerfCounterStats m_PerfCounterTotals;
+
             template <Concepts::ValidUnitTestRangeSource RangeT>
             constexpr RunResults(
                 _In_ const std::string_view originSuiteNameSV,
                 _Inout_ RangeT&& tests) :
+                m_pNameArena{Internal_::MakeStringArena(Internal_::EstimateStringArenaSize(std::ranges::size(tests)))},
+                m_OriginSuiteNameSV{originSuiteNameSV}
+            {
+                m_UnitTests.reserve(std::ranges::size(tests));
+                AppendTests(m_UnitTests, std::forward<RangeT>(tests), Internal_::GetArenaAllocator(m_pNameArena));
+                for (const Test& test : m_UnitTests)
+                {
+                    ++m_ResultTypeCounts[static_cast<std::size_t>(test.GetResult().m_ResultType)];
+                }
+            }
+
+            // For when the counts were kept while the tests ran (as Suite does), so there's no need to re-walk the tests.
+            template <Concepts::ValidUnitTestRangeSource RangeT>
+            constexpr RunResults(
+                _In_ const std::string_view originSuiteNameSV,
+                _Inout_ RangeT&& tests,
+                _In_ const ResultTypeCounts& resultTypeCounts) :
+                m_pNameArena{Internal_::MakeStringArena(Internal_::EstimateStringArenaSize(std::ranges::size(tests)))},
                 m_OriginSuiteNameSV{originSuiteNameSV},
-                m_UnitTests(std::forward<RangeT>(tests))
-            { }
+                m_ResultTypeCounts{resultTypeCounts}
+            {
+                m_UnitTests.reserve(std::ranges::size(tests));
+                AppendTests(m_UnitTests, std::forward<RangeT>(tests), Internal_::GetArenaAllocator(m_pNameArena));
+            }
+
+            constexpr RunResults(_In_ const RunResults& other) :
+                RunResults{other.m_OriginSuiteNameSV, other.m_UnitTests, other.m_ResultTypeCounts}
+            {
+                m_PerfCounterTotals = other.m_PerfCounterTotals;
+            }
+
+            constexpr RunResults(_Inout_ RunResults&& other) noexcept = default;
+
+            constexpr RunResults& operator=(_In_ const RunResults& other)
+            {
+                if (this != &other)
+                {
+                    *this = RunResults{other};
+                }
+
+                return *this;
+            }
+
+            constexpr RunResults& operator=(_Inout_ RunResults&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    m_UnitTests = std::move(other.m_UnitTests);
+                    m_pNameArena = std::move(other.m_pNameArena); // Only once the tests named from the old arena are gone.
+                    m_OriginSuiteNameSV = std::move(other.m_OriginSuiteNameSV);
+                    m_ResultTypeCounts = other.m_ResultTypeCounts;
+                    m_PerfCounterTotals = other.m_PerfCounterTotals;
+                }
+
+                return *this;
+            }
 
             [[nodiscard]] constexpr explicit operator bool() const noexcept
             {
-                return std::ranges::all_of(
-                    m_UnitTests,
-                    [](_In_ const Test& unitTest) static constexpr { return !!unitTest.GetResult(); });
+                return GetFailureCount(m_ResultTypeCounts) == 0;
+            }
+
+            [[nodiscard]] constexpr const ResultTypeCounts& GetResultTypeCounts() const noexcept
+            {
+                return m_ResultTypeCounts;
+            }
+
+            // What report formatting needs to know up front, gathered in one pass over the listed tests.
+            struct ReportLayout
+            {
+                std::size_t m_MaxTestNameLength{0};
+                std::size_t m_NonSuccessCount{0};
+                std::size_t m_NonSuccessInfoSize{0};
+            };
+
+            [[nodiscard]] constexpr ReportLayout GetReportLayout() const noexcept
+            {
+                ReportLayout reportLayout;
+                for (const Test& test : m_UnitTests)
+                {
+                    const Result& result{test.GetResult()};
+                    reportLayout.m_MaxTestNameLength = std::max(reportLayout.m_MaxTestNameLength, test.GetTestName().length());
+                    if (result.m_ResultType != ResultType::Success)
+                    {
+                        ++reportLayout.m_NonSuccessCount;
+                        reportLayout.m_NonSuccessInfoSize += result.m_Info.size();
+                    }
+                }
+
+                return reportLayout;
             }
 
             [[nodiscard]] constexpr auto begin() noexcept { return m_UnitTests.begin(); }
@@ -215,43 +735,38 @@ namespace SimpleUnitTestLibrary
             [[nodiscard]] constexpr auto rend() const noexcept { return m_UnitTests.rend(); }
             [[nodiscard]] constexpr auto crend() const noexcept { return m_UnitTests.crend(); }
 
-            [[nodiscard]] std::string ToString(_In_ const std::size_t spaces = 0) const
+            // Formats the report straight into out; ToString() pre-sizes a buffer and formats into that.
+            template <std::output_iterator<char> OutputItT>
+            OutputItT FormatTo(
+                _In_ OutputItT out,
+                _In_ const std::size_t spaces = 0) const
             {
-                std::string ret;
-                ret += std::format("\n{:<{}}{} Run Results:\n", ""sv, spaces, m_OriginSuiteNameSV);
+                return FormatTo(std::move(out), GetReportLayout(), spaces);
+            }
 
-                const std::size_t maxTestNameLength{
-                    std::ranges::max_element(
-                        m_UnitTests,
-                        [](_In_ const Test& lhs, _In_ const Test& rhs) static constexpr
-                        {
-                            return lhs.GetTestName().length() < rhs.GetTestName().length();
-                        })->GetTestName().length()};
+            template <std::output_iterator<char> OutputItT>
+            OutputItT FormatTo(
+                _In_ OutputItT out,
+                _In_ const ReportLayout& reportLayout,
+                _In_ const std::size_t spaces = 0) const
+            {
+                out = std::format_to(std::move(out), "\n{:<{}}{} Run Results:\n", ""sv, spaces, m_OriginSuiteNameSV);
 
-                std::array<std::uint32_t, static_cast<std::size_t>(ResultType::_End)> resultTypeCounts{0};
+                const ResultTypeCounts& resultTypeCounts{m_ResultTypeCounts};
+                const std::size_t testNameWidth{std::min(std::size_t{72}, reportLayout.m_MaxTestNameLength + 1)};
                 for (const Test& test : m_UnitTests)
                 {
                     const Result& result{test.GetResult()};
-
-                    ++resultTypeCounts[static_cast<std::size_t>(result.m_ResultType)];
                     if (result.m_ResultType != ResultType::Success)
                     {
-                        ret += '\n';
+                        *out++ = '\n';
                     }
 
-                    ret += std::format("{:<{}}{:<{}}{}\n",
-                        "", spaces + 2, test.GetTestName(), std::min(std::size_t{72}, maxTestNameLength + 1),
-                        result.ToString(spaces + 2));
+                    out = Internal_::FormatPaddedTo(std::move(out), spaces + 2, test.GetTestName(), testNameWidth);
+                    out = result.FormatTo(std::move(out), spaces + 2);
+                    *out++ = '\n';
                 }
 
-                auto GetTotalFailureCount = [&resultTypeCounts]() constexpr -> std::uint64_t
-                {
-                    return resultTypeCounts[static_cast<std::size_t>(ResultType::SetupFailure)]
-                        + resultTypeCounts[static_cast<std::size_t>(ResultType::TestFailure)]
-                        + resultTypeCounts[static_cast<std::size_t>(ResultType::CleanupFailure)]
-                        + resultTypeCounts[static_cast<std::size_t>(ResultType::UnhandledException)];
-                };
-
                 auto GetResultTypeCount = [&resultTypeCounts](_In_ const ResultType resultType) constexpr -> std::uint64_t
                 {
                     return (resultType < ResultType::_End)
@@ -259,10 +774,11 @@ namespace SimpleUnitTestLibrary
                         : std::accumulate(resultTypeCounts.cbegin(), resultTypeCounts.cend(), 0ull, std::plus<>{});
                 };
 
-                const auto totalFailureCount{GetTotalFailureCount()};
+                const auto totalFailureCount{GetFailureCount(resultTypeCounts)};
                 if (totalFailureCount == 0)
                 {
-                    ret += std::format(
+                    out = std::format_to(
+                        std::move(out),
                         Internal_::g_cResultCountWithoutFailureDetailsFormatSV,
                         m_OriginSuiteNameSV,
                         GetResultTypeCount(ResultType::_End),
@@ -273,7 +789,8 @@ namespace SimpleUnitTestLibrary
                 }
                 else
                 {
-                    ret += std::format(
+                    out = std::format_to(
+                        std::move(out),
                         Internal_::g_cResultCountWithFailureDetailsFormatSV,
                         m_OriginSuiteNameSV,
                         GetResultTypeCount(ResultType::_End),
@@ -284,46 +801,356 @@ namespace SimpleUnitTestLibrary
                         GetResultTypeCount(ResultType::SetupFailure),
                         GetResultTypeCount(ResultType::TestFailure),
                         GetResultTypeCount(ResultType::CleanupFailure),
-                        GetResultTypeCount(ResultType::UnhandledException));
+                        GetResultTypeCount(ResultType::UnhandledException),
+                        GetResultTypeCount(ResultType::LeakFailure));
+                }
+
+                if (m_PerfCounterTotals.m_bMeasured)
+                {
+                    out = std::format_to(std::move(out), "  Perf Counters: {}\n", m_PerfCounterTotals.ToString());
                 }
 
+                return out;
+            }
+
+            [[nodiscard]] std::string ToString(_In_ const std::size_t spaces = 0) const
+            {
+                // Generous per-line estimates; the point is to grow the buffer (and copy the report) rarely, if ever.
+                static constexpr std::size_t cResultLineSize{std::string_view{"Result: UnhandledException\n"}.size()};
+                static constexpr std::size_t cAllocationStatsSize{96};
+                static constexpr std::size_t cFailureDetailsSize{256};
+                static constexpr std::size_t cSummarySize{512};
+
+                const ReportLayout reportLayout{GetReportLayout()};
+                const std::size_t lineSize{
+                    (2 * (spaces + 2)) + std::min(std::size_t{72}, reportLayout.m_MaxTestNameLength + 1) + cResultLineSize
+                    + (IsAllocationTrackingEnabled() ? cAllocationStatsSize : 0)};
+
+                std::string ret;
+                ret.reserve(cSummarySize + (m_OriginSuiteNameSV.size() * 2) + (m_UnitTests.size() * lineSize)
+                    + (reportLayout.m_NonSuccessCount * cFailureDetailsSize) + reportLayout.m_NonSuccessInfoSize);
+
+                FormatTo(std::back_inserter(ret), reportLayout, spaces);
                 return ret;
             }
         };
 
         [[nodiscard]] constexpr RunResults operator()() const noexcept
         {
-            auto InvokeTest = [](_In_ const Test& test) static constexpr
+            // Results are streamed to reporters (trace, JUnit, ...) when any are active (never during constant evaluation).
+            const std::vector<Reporter*>* pReporters{nullptr};
+            if not consteval
+            {
+                pReporters = Internal_::GetActiveReporters();
+            }
+
+            auto Now = [pReporters]() constexpr -> std::uint64_t
+            {
+                return !pReporters ? 0 : Internal_::GetTimestampNs();
+            };
+
+            auto ReportTestEnd = [this, pReporters](
+                _In_ const std::string_view testNameSV,
+                _In_ const TestStage testStage,
+                _In_ const Result& result,
+                _In_ const std::uint64_t beginNs,
+                _In_ const std::uint64_t endNs) constexpr
+            {
+                for (Reporter* const pReporter : *pReporters)
+                {
+                    pReporter->OnTestEnd(m_SuiteName, testNameSV, testStage, result, beginNs, endNs);
+                }
+            };
+
+            // Kept up to date as each test completes, both for this suite's results and for the whole run (see GetRunCounters).
+            ResultTypeCounts resultTypeCounts{};
+            auto CountResult = [&resultTypeCounts](
+                _In_ const ResultType resultType,
+                _In_ const std::uint64_t count = 1) constexpr
             {
-                test();
+                resultTypeCounts[static_cast<std::size_t>(resultType)] += count;
+                if not consteval
+                {
+                    Internal_::g_RunCounters.Record(resultType, count);
+                }
             };
 
-            if (!m_UnitTests.empty())
+            const std::uint64_t suiteBeginNs{Now()};
+            if (pReporters != nullptr)
+            {
+                for (Reporter* const pReporter : *pReporters)
+                {
+                    pReporter->OnSuiteBegin(m_SuiteName, suiteBeginNs);
+                }
+            }
+
+            // Summed over every test that runs; only measured when perf counters are enabled.
+            PerfCounterStats perfCounterTotals;
+
+            // Like Test::operator(), a test only runs once; a suite run again reports the same results.
+            // A test that passes with nothing to report (see UnitTestTable) touches only the hot arrays.
+            auto InvokeTest = [this, &Now, &ReportTestEnd, &CountResult, &perfCounterTotals, pReporters](
+                _In_ const std::size_t testIndex,
+                _In_ const TestStage testStage) constexpr -> ResultType
             {
-                if (!!m_SuiteSetupFn)
+                const std::uint64_t beginNs{Now()};
+                ResultType& resultType{m_UnitTests.m_ResultTypes[testIndex]};
+                bool bResultStored{true};
+                if (resultType == ResultType::NotRun)
                 {
-                    const auto& suiteSetup{m_UnitTests.front()};
-                    if (!!suiteSetup())
+                    const TestFunction testFn{m_UnitTests.m_TestFns[testIndex]};
+                    Result result;
+                    if consteval
+                    {
+                        result = testFn();
+                    }
+                    else
+                    {
+                        result = Internal_::InvokeInstrumentedTest(testFn);
+                    }
+
+                    if (testStage == TestStage::Test)
                     {
-                        // Only run tests if suite setup was successful.
-                        const auto subRange{std::ranges::subrange{m_UnitTests.cbegin() + 1, m_UnitTests.cend()}};
-                        std::ranges::for_each(subRange, InvokeTest);
+                        CheckForLeaks(result);
                     }
-                    if (!!m_SuiteCleanupFn)
+                    resultType = result.m_ResultType;
+
+                    const bool bPlainSuccess{(resultType == ResultType::Success) && result.m_Info.empty() && !result.m_Measurements.Get()};
+                    bResultStored = !bPlainSuccess || (pReporters != nullptr);
+                    if (bResultStored)
                     {
-                        // Even if we're skipping the main body of tests due to setup failure
-                        // be sure to run suite cleanup so it can handle any needed teardown to avoid leaks, etc.
-                        const auto& suiteCleanup{m_UnitTests.back()};
-                        suiteCleanup();
+                        m_UnitTests.m_Results[testIndex] = std::move(result);
                     }
                 }
+                else if (m_UnitTests.m_Results[testIndex].m_ResultType == ResultType::NotRun)
+                {
+                    // It passed with nothing to report, in an earlier run of the suite.
+                    m_UnitTests.m_Results[testIndex] = GetUnitTestResult(testIndex);
+                }
+
+                CountResult(resultType);
+                if (!bResultStored)
+                {
+                    return resultType;
+                }
+
+                const Result& result{m_UnitTests.m_Results[testIndex]};
+                perfCounterTotals += result.GetPerfCounterStats();
+                if (pReporters != nullptr)
+                {
+                    if ((testStage == TestStage::SuiteSetup) && (m_UnitTests.m_SetupEndNs != 0))
+                    {
+                        ReportTestEnd(m_UnitTests.m_TestNames[testIndex], testStage, result, m_UnitTests.m_SetupBeginNs, m_UnitTests.m_SetupEndNs);
+                    }
+                    else
+                    {
+                        ReportTestEnd(m_UnitTests.m_TestNames[testIndex], testStage, result, beginNs, Now());
+                    }
+                }
+
+                return resultType;
+            };
+
+            auto ReportSuiteEnd = [this, pReporters, suiteBeginNs, &Now](_In_ const RunResults& runResults) constexpr
+            {
+                if (pReporters != nullptr)
+                {
+                    const std::uint64_t suiteEndNs{Now()};
+                    for (Reporter* const pReporter : *pReporters)
+                    {
+                        pReporter->OnSuiteEnd(m_SuiteName, runResults.GetResultTypeCounts(), suiteBeginNs, suiteEndNs);
+                    }
+                }
+            };
+
+            // With --shuffle, unit tests (and each generator's tests) run in a seeded random order; setup still runs first
+            // and cleanup last, and results are still listed in declaration order.
+            bool bShuffle{false};
+            std::uint64_t shuffleSeed{0};
+
+            // When Runner's filter can't select this suite's tests by suite name alone, tests it doesn't select
+            // are neither run nor listed (setup and cleanup always run).
+            const TestFilter* pTestFilter{nullptr};
+            if not consteval
+            {
+                bShuffle = Internal_::IsShuffleEnabled();
+                shuffleSeed = Internal_::MixShuffleSeed(Internal_::g_ShuffleSeed.load(std::memory_order_relaxed), m_SuiteName);
+
+                pTestFilter = Internal_::GetActiveTestFilter();
+                if ((pTestFilter != nullptr) && (pTestFilter->SelectSuite(m_SuiteName) != FilterSelection::PerTest))
+                {
+                    pTestFilter = nullptr;
+                }
+            }
+
+            auto IsTestSelected = [this, pTestFilter](_In_ const std::string_view testNameSV, _In_ const TestTags testTags = {}) constexpr
+            {
+                return (pTestFilter == nullptr) || pTestFilter->IsTestSelected(m_SuiteName, testNameSV, testTags);
+            };
+            auto IsUnitTestSelected = [this, pTestFilter](_In_ const std::size_t testIndex)
+            {
+                return (pTestFilter == nullptr) || Suite::IsUnitTestSelected(*pTestFilter, testIndex);
+            };
+
+            // Suite setup/cleanup (when present) bookend the unit tests in m_UnitTests.
+            const std::size_t bodyBegin{GetBodyBegin()};
+            const std::size_t bodyEnd{GetBodyEnd()};
+
+            // Only run tests if suite setup was successful.
+            const bool bRunBody{!m_SuiteSetupFn || !!Result{InvokeTest(0, TestStage::SuiteSetup)}};
+            if (bShuffle || (pTestFilter != nullptr))
+            {
+                std::vector<std::size_t> selectedTests;
+                for (std::size_t i = bodyBegin; i < bodyEnd; ++i)
+                {
+                    if (IsUnitTestSelected(i))
+                    {
+                        selectedTests.push_back(i);
+                    }
+                }
+
+                if (!bRunBody)
+                {
+                    CountResult(ResultType::NotRun, selectedTests.size());
+                }
                 else
                 {
-                    std::ranges::for_each(m_UnitTests, InvokeTest);
+                    if (bShuffle)
+                    {
+                        Internal_::ShuffleInPlace(selectedTests, shuffleSeed);
+                    }
+                    std::ranges::for_each(selectedTests, [&InvokeTest](_In_ const std::size_t i) constexpr { InvokeTest(i, TestStage::Test); });
+                }
+            }
+            else if (bRunBody)
+            {
+                for (std::size_t i = bodyBegin; i < bodyEnd; ++i)
+                {
+                    InvokeTest(i, TestStage::Test);
                 }
             }
+            else
+            {
+                CountResult(ResultType::NotRun, static_cast<std::uint64_t>(bodyEnd - bodyBegin));
+            }
+
+            std::vector<Test> generatedTests;
+            std::string reportedTestName;
+            std::vector<std::size_t> selectedTestIndices;
+            std::vector<std::uint64_t> testBeginNs;
+            for (const auto& pTestGenerator : m_TestGenerators)
+            {
+                const std::size_t testCount{pTestGenerator->GetTestCount()};
+                if (!bRunBody)
+                {
+                    std::uint64_t selectedCount{testCount};
+                    if (pTestFilter != nullptr)
+                    {
+                        selectedCount = 0;
+                        for (std::size_t i = 0; i < testCount; ++i)
+                        {
+                            pTestGenerator->FormatTestName(i, reportedTestName);
+                            selectedCount += IsTestSelected(reportedTestName, pTestGenerator->GetTestTags(i)) ? 1 : 0;
+                        }
+                    }
+
+                    CountResult(ResultType::NotRun, selectedCount);
+                    continue;
+                }
+
+                if (bShuffle)
+                {
+                    // A distinct seed per generator, so equally sized generators aren't permuted identically.
+                    selectedTestIndices = Internal_::MakeShuffledIndices(testCount, ++shuffleSeed);
+                }
+                else
+                {
+                    selectedTestIndices.resize(testCount);
+                    std::iota(selectedTestIndices.begin(), selectedTestIndices.end(), std::size_t{0});
+                }
+
+                if (pTestFilter != nullptr)
+                {
+                    std::erase_if(selectedTestIndices,
+                        [&](_In_ const std::size_t i)
+                        {
+                            pTestGenerator->FormatTestName(i, reportedTestName);
+                            return !IsTestSelected(reportedTestName, pTestGenerator->GetTestTags(i));
+                        });
+                }
+
+                // Tests may finish out of order (e.g., async tests), so each one's begin time is kept until it does.
+                if (pReporters != nullptr)
+                {
+                    testBeginNs.resize(testCount);
+                }
+
+                auto OnTestBegin = [&testBeginNs, &Now, pReporters](_In_ const std::size_t i) constexpr
+                {
+                    if (pReporters != nullptr)
+                    {
+                        testBeginNs[i] = Now();
+                    }
+                };
+                auto OnTestEnd = [&](_In_ const std::size_t i, _Inout_ Result&& result) constexpr
+                {
+                    CheckForLeaks(result);
+                    if (pReporters != nullptr)
+                    {
+                        pTestGenerator->FormatTestName(i, reportedTestName);
+                        ReportTestEnd(reportedTestName, TestStage::Test, result, testBeginNs[i], Now());
+                    }
+
+                    perfCounterTotals += result.GetPerfCounterStats();
+                    CountResult(result.m_ResultType);
+                    if (result.m_ResultType == ResultType::Success)
+                    {
+                        return;
+                    }
+
+                    std::string testName;
+                    pTestGenerator->FormatTestName(i, testName);
+                    const Test& generatedTest{generatedTests.emplace_back(testName, TestFunction{}, pTestGenerator->GetTestTags(i))};
+                    generatedTest.m_Result = std::move(result);
+                };
+
+                Internal_::TestResultSinkFn resultSink{OnTestBegin, OnTestEnd};
+                pTestGenerator->RunTests(selectedTestIndices, resultSink);
+            }
+
+            if (!!m_SuiteCleanupFn)
+            {
+                // Even if we're skipping the main body of tests due to setup failure
+                // be sure to run suite cleanup so it can handle any needed teardown to avoid leaks, etc.
+                InvokeTest(m_UnitTests.size() - 1, TestStage::SuiteCleanup);
+            }
+
+            // Only the tests that ran (or were selected but couldn't) are listed, each copied straight from m_UnitTests.
+            RunResults runResults{m_SuiteName, resultTypeCounts, m_UnitTests.size() + generatedTests.size()};
+            const Internal_::ArenaAllocator<char> nameAllocator{Internal_::GetArenaAllocator(runResults.m_pNameArena)};
+            for (std::size_t i = 0; i < bodyBegin; ++i)
+            {
+                runResults.m_UnitTests.push_back(MakeTest(i, nameAllocator));
+            }
+            for (std::size_t i = bodyBegin; i < bodyEnd; ++i)
+            {
+                if (IsUnitTestSelected(i))
+                {
+                    runResults.m_UnitTests.push_back(MakeTest(i, nameAllocator));
+                }
+            }
+            for (Test& generatedTest : generatedTests)
+            {
+                runResults.m_UnitTests.push_back(Test{std::move(generatedTest), nameAllocator});
+            }
+            for (std::size_t i = bodyEnd; i < m_UnitTests.size(); ++i)
+            {
+                runResults.m_UnitTests.push_back(MakeTest(i, nameAllocator));
+            }
 
-            return RunResults{m_SuiteName, m_UnitTests};
+            runResults.m_PerfCounterTotals = perfCounterTotals;
+            ReportSuiteEnd(runResults);
+            return runResults;
         }
     };
 }
@@ -0,0 +1,162 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <concepts>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Utils.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // A tag marks a test as, e.g., slow or serial-only, for filters ("[slow]", "-[slow]") and scheduling.
+    // The built-in tags are listed here; more can be added at runtime with RegisterTag, up to Tag::_End in total.
+    enum class Tag : std::uint8_t
+    {
+        Slow,
+        Integration,
+
+        // Runs alone: after the fixture pool's parallel tests, one at a time, with no suite setup pipelined alongside
+        // (see Runner::m_SetupPipelineDepth). SUTL_CREATE_DEATH_TEST tags death tests so; their forks also wait out the
+        // library's other threads (see Internal_::ForkGate).
+        SerialOnly,
+        RequiresRoot,
+
+        _BuiltInEnd,
+        _End = 32
+    };
+
+    // The set of tags on a test: a bitset, so it costs a test only a few bytes.
+    class [[nodiscard]] TestTags
+    {
+    private:
+
+        std::uint32_t m_Bits{0};
+
+        [[nodiscard]] static constexpr std::uint32_t ToBit(_In_ const Tag tag) noexcept
+        {
+            return std::uint32_t{1} << static_cast<std::uint32_t>(tag);
+        }
+
+    public:
+
+        constexpr TestTags() noexcept = default;
+
+        template <std::same_as<Tag>... TagTs>
+        constexpr TestTags(_In_ const TagTs... tags) noexcept :
+            m_Bits{(std::uint32_t{0} | ... | ToBit(tags))}
+        { }
+
+        [[nodiscard]] constexpr bool Contains(_In_ const Tag tag) const noexcept
+        {
+            return (m_Bits & ToBit(tag)) != 0;
+        }
+
+        [[nodiscard]] constexpr bool ContainsAny(_In_ const TestTags other) const noexcept
+        {
+            return (m_Bits & other.m_Bits) != 0;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return m_Bits == 0;
+        }
+
+        [[nodiscard]] constexpr std::uint32_t GetBits() const noexcept
+        {
+            return m_Bits;
+        }
+
+        [[nodiscard]] constexpr TestTags operator|(_In_ const TestTags other) const noexcept
+        {
+            TestTags ret;
+            ret.m_Bits = m_Bits | other.m_Bits;
+            return ret;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const TestTags&) const noexcept = default;
+    };
+
+    namespace Internal_
+    {
+        struct TagRegistry
+        {
+            std::mutex m_Mutex;
+
+            // Indexed by Tag; reserved up front, so names never move once registered.
+            std::vector<std::string> m_Names;
+
+            TagRegistry()
+            {
+                m_Names.reserve(static_cast<std::size_t>(Tag::_End));
+                m_Names.assign({"slow", "integration", "serial-only", "requires-root"});
+            }
+        };
+
+        [[nodiscard]] inline TagRegistry& GetTagRegistry()
+        {
+            static TagRegistry s_TagRegistry;
+            return s_TagRegistry;
+        }
+
+        // Callers hold m_Mutex.
+        [[nodiscard]] inline std::optional<Tag> FindTagLocked(
+            _In_ const TagRegistry& tagRegistry,
+            _In_ const std::string_view tagNameSV) noexcept
+        {
+            for (std::size_t i = 0; i < tagRegistry.m_Names.size(); ++i)
+            {
+                if (Utils::EqualsIgnoreCaseAscii(tagRegistry.m_Names[i], tagNameSV))
+                {
+                    return static_cast<Tag>(i);
+                }
+            }
+
+            return std::nullopt;
+        }
+    }
+
+    // Looks a tag up by (case-insensitive) name, e.g., "serial-only".
+    [[nodiscard]] inline std::optional<Tag> FindTag(_In_ const std::string_view tagNameSV)
+    {
+        Internal_::TagRegistry& tagRegistry{Internal_::GetTagRegistry()};
+        const std::lock_guard lock{tagRegistry.m_Mutex};
+        return Internal_::FindTagLocked(tagRegistry, tagNameSV);
+    }
+
+    // Returns the tag with this name, registering it if needed; nullopt once all Tag::_End tags are taken.
+    [[nodiscard]] inline std::optional<Tag> RegisterTag(_In_ const std::string_view tagNameSV)
+    {
+        Internal_::TagRegistry& tagRegistry{Internal_::GetTagRegistry()};
+        const std::lock_guard lock{tagRegistry.m_Mutex};
+        if (const std::optional<Tag> tag{Internal_::FindTagLocked(tagRegistry, tagNameSV)})
+        {
+            return tag;
+        }
+
+        if (tagRegistry.m_Names.size() >= static_cast<std::size_t>(Tag::_End))
+        {
+            return std::nullopt;
+        }
+
+        tagRegistry.m_Names.emplace_back(tagNameSV);
+        return static_cast<Tag>(tagRegistry.m_Names.size() - 1);
+    }
+
+    [[nodiscard]] inline std::string_view GetTagName(_In_ const Tag tag)
+    {
+        Internal_::TagRegistry& tagRegistry{Internal_::GetTagRegistry()};
+        const std::lock_guard lock{tagRegistry.m_Mutex};
+        const auto index{static_cast<std::size_t>(tag)};
+        return (index < tagRegistry.m_Names.size()) ? std::string_view{tagRegistry.m_Names[index]} : std::string_view{};
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -1,10 +1,24 @@
 #pragma once
 
 #if !defined(SUTL_USE_MODULES)
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 #include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.AllocationTracking.h"
+#include "SimpleUnitTestLibrary.Arena.h"
 #include "SimpleUnitTestLibrary.Result.h"
+#include "SimpleUnitTestLibrary.Tags.h"
 #endif
 
 namespace SimpleUnitTestLibrary
@@ -16,31 +30,177 @@ namespace SimpleUnitTestLibrary
 
     class Suite;
 
+    namespace Internal_
+    {
+        // Runs a test function with the current thread's heap activity and hardware counters measured into the returned Result.
+        template <std::invocable TestFnT>
+        [[nodiscard]] Result InvokeInstrumentedTest(_Inout_ TestFnT&& testFn)
+        {
+            const AllocationScope allocationScope;
+            Result result;
+            PerfCounterStats perfCounterStats;
+            {
+                const PerfCounterScope perfCounterScope;
+                result = std::invoke(std::forward<TestFnT>(testFn));
+                perfCounterStats = perfCounterScope.GetStats();
+            }
+            AllocationStats allocationStats{allocationScope.GetStats()};
+
+            if (allocationStats.m_bTracked && !result.m_Info.empty())
+            {
+                // The info string was allocated by the test, but now belongs to the caller; it isn't a leak.
+                // Swap in a copy, and discount whatever freeing the test's own buffer gives back.
+                std::int64_t liveBytes;
+                {
+                    std::string info{result.m_Info};
+                    liveBytes = g_tlsAllocationCounters.m_LiveBytes;
+                    result.m_Info.swap(info);
+                }
+                allocationStats.m_NetLiveBytes -= liveBytes - g_tlsAllocationCounters.m_LiveBytes;
+            }
+
+            if (allocationStats.m_bTracked || perfCounterStats.m_bMeasured)
+            {
+                result.m_Measurements.Emplace(TestMeasurements{allocationStats, perfCounterStats});
+            }
+
+            return result;
+        }
+    }
+
+    // Succeeds if statement performs no heap allocations on the current thread.
+    // Skipped when allocation tracking isn't installed, since nothing could be verified.
+    template <std::invocable StatementT>
+    [[nodiscard]] Result ExpectNoAllocations(
+        _Inout_ StatementT&& statement,
+        _In_ const std::string_view statementSV,
+        _In_ const std::source_location srcLoc = std::source_location::current())
+    {
+        if (!IsAllocationTrackingEnabled())
+        {
+            return Result{
+                ResultType::Skipped,
+                srcLoc,
+                std::format("Allocations in \"{}\" not checked: allocation tracking is not installed", statementSV)};
+        }
+
+        AllocationStats allocationStats;
+        {
+            const AllocationScope allocationScope;
+            std::invoke(std::forward<StatementT>(statement));
+            allocationStats = allocationScope.GetStats();
+        }
+
+        if (allocationStats.m_AllocationCount != 0)
+        {
+            return Result{
+                ResultType::TestFailure,
+                srcLoc,
+                std::format("\"{}\" performed {} allocation(s) totalling {} bytes",
+                    statementSV, allocationStats.m_AllocationCount, allocationStats.m_AllocatedBytes)};
+        }
+
+        return Result{ResultType::Success, srcLoc};
+    }
+
     class [[nodiscard]] Test
     {
         friend class Suite;
     private:
 
-        std::string m_TestNameSV;
+        // Heap-backed, unless the test belongs to a Suite or RunResults, which keep their tests' names in an arena.
+        Internal_::ArenaString m_TestNameSV;
         TestFunction m_TestFn;
+        TestTags m_Tags;
+
+        // Where the test was created (e.g., its SUTL_CREATE_UNIT_TEST), for listing tests without running them.
+        std::source_location m_SourceLocation;
 
         mutable Result m_Result;
 
+        // For Suite (and its RunResults), which keep their tests' names in an arena: allocator-extended copy/move,
+        // and construction from a name already built in the arena.
+        constexpr Test(
+            _In_ const Test& other,
+            _In_ const Internal_::ArenaAllocator<char>& nameAllocator) :
+            m_TestNameSV{other.m_TestNameSV, nameAllocator},
+            m_TestFn{other.m_TestFn},
+            m_Tags{other.m_Tags},
+            m_SourceLocation{other.m_SourceLocation},
+            m_Result{other.m_Result}
+        {
+        }
+
+        constexpr Test(
+            _Inout_ Test&& other,
+            _In_ const Internal_::ArenaAllocator<char>& nameAllocator) :
+            m_TestNameSV{std::move(other.m_TestNameSV), nameAllocator},
+            m_TestFn{other.m_TestFn},
+            m_Tags{other.m_Tags},
+            m_SourceLocation{other.m_SourceLocation},
+            m_Result{std::move(other.m_Result)}
+        {
+        }
+
+        constexpr Test(
+            _Inout_ Internal_::ArenaString&& testName,
+            _In_ const TestFunction testFn,
+            _In_ const TestTags tags,
+            _In_ const std::source_location& srcLoc) :
+            m_TestNameSV{std::move(testName)},
+            m_TestFn{testFn},
+            m_Tags{tags},
+            m_SourceLocation{srcLoc}
+        {
+        }
+
     public:
 
         constexpr Test(
             _In_ const std::string_view testNameSV,
-            _In_ const TestFunction testFn) :
+            _In_ const TestFunction testFn,
+            _In_ const TestTags tags = {},
+            _In_ const std::source_location srcLoc = std::source_location::current()) :
             m_TestNameSV{testNameSV},
-            m_TestFn{testFn}
+            m_TestFn{testFn},
+            m_Tags{tags},
+            m_SourceLocation{srcLoc}
+        {
+        }
+
+        // Moving a string moves its allocator, so a moved-from arena-backed name would still point into (and later free into)
+        // the arena of the Suite or RunResults it came from, which may not outlive the new Test. A moved Test's name is
+        // rehomed onto the heap instead (a copy, for a name in an arena; heap-backed names are just moved). Suite and
+        // RunResults keep their tests' names in their own arena with the allocator-extended constructors above.
+        constexpr Test(_Inout_ Test&& other) :
+            m_TestNameSV{std::move(other.m_TestNameSV), Internal_::ArenaAllocator<char>{}},
+            m_TestFn{other.m_TestFn},
+            m_Tags{other.m_Tags},
+            m_SourceLocation{other.m_SourceLocation},
+            m_Result{std::move(other.m_Result)}
         {
         }
 
+        // Copies are heap-backed (see ArenaAllocator), and assignment keeps the target's allocator.
+        constexpr Test(const Test&) = default;
+        constexpr Test& operator=(const Test&) = default;
+        constexpr Test& operator=(Test&&) = default;
+
         [[nodiscard]] constexpr std::string_view GetTestName() const noexcept
         {
             return m_TestNameSV;
         }
 
+        [[nodiscard]] constexpr TestTags GetTags() const noexcept
+        {
+            return m_Tags;
+        }
+
+        [[nodiscard]] constexpr const std::source_location& GetSourceLocation() const noexcept
+        {
+            return m_SourceLocation;
+        }
+
         [[nodiscard]] constexpr const Result& GetResult() const noexcept
         {
             return m_Result;
@@ -50,12 +210,177 @@ namespace SimpleUnitTestLibrary
         {
             if (m_Result.m_ResultType == ResultType::NotRun)
             {
-                m_Result = m_TestFn();
+                if consteval
+                {
+                    m_Result = m_TestFn();
+                }
+                else
+                {
+                    m_Result = Internal_::InvokeInstrumentedTest(m_TestFn);
+                }
             }
 
             return m_Result;
         }
     };
+
+    // Receives the results of a TestGenerator's tests as they run (see TestGenerator::RunTests).
+    class TestResultSink
+    {
+    public:
+
+        constexpr virtual void OnTestBegin(_In_ const std::size_t testIndex) = 0;
+        constexpr virtual void OnTestEnd(
+            _In_ const std::size_t testIndex,
+            _Inout_ Result&& result) = 0;
+
+    protected:
+
+        constexpr ~TestResultSink() noexcept = default;
+    };
+
+    // Produces tests on demand rather than as up-front Test objects (e.g., one per record of a large
+    // parameter file). Suite only materializes a named Test for generated tests that need reporting.
+    class TestGenerator
+    {
+    public:
+
+        constexpr virtual ~TestGenerator() noexcept = default;
+
+        [[nodiscard]] virtual std::size_t GetTestCount() const = 0;
+
+        // Replaces the contents of testName with the name of the test at testIndex.
+        virtual void FormatTestName(
+            _In_ const std::size_t testIndex,
+            _Inout_ std::string& testName) const = 0;
+
+        [[nodiscard]] virtual Result RunTest(_In_ const std::size_t testIndex) const = 0;
+
+        // Tags of the test at testIndex, for filters and listing.
+        [[nodiscard]] virtual TestTags GetTestTags(_In_ const std::size_t /*testIndex*/) const
+        {
+            return {};
+        }
+
+        // Runs the tests at testIndices (in that order), passing each one's result to resultSink, on the calling thread.
+        // By default each test runs to completion, instrumented, before the next begins; a generator whose tests can
+        // overlap (e.g., AsyncTestGenerator) may have them in flight together, and report results as they finish.
+        constexpr virtual void RunTests(
+            _In_ const std::span<const std::size_t> testIndices,
+            _Inout_ TestResultSink& resultSink) const
+        {
+            for (const std::size_t testIndex : testIndices)
+            {
+                resultSink.OnTestBegin(testIndex);
+                if consteval
+                {
+                    resultSink.OnTestEnd(testIndex, RunTest(testIndex));
+                }
+                else
+                {
+                    resultSink.OnTestEnd(testIndex, Internal_::InvokeInstrumentedTest([this, testIndex]() { return RunTest(testIndex); }));
+                }
+            }
+        }
+    };
+
+    namespace Internal_
+    {
+        // A TestResultSink over callables, e.g., lambdas sharing a Suite run's state.
+        template <typename BeginFnT, typename EndFnT>
+        class TestResultSinkFn final : public TestResultSink
+        {
+        private:
+
+            BeginFnT& m_BeginFn;
+            EndFnT& m_EndFn;
+
+        public:
+
+            constexpr TestResultSinkFn(
+                _In_ BeginFnT& beginFn,
+                _In_ EndFnT& endFn) noexcept :
+                m_BeginFn{beginFn},
+                m_EndFn{endFn}
+            { }
+
+            constexpr void OnTestBegin(_In_ const std::size_t testIndex) override
+            {
+                std::invoke(m_BeginFn, testIndex);
+            }
+
+            constexpr void OnTestEnd(
+                _In_ const std::size_t testIndex,
+                _Inout_ Result&& result) override
+            {
+                std::invoke(m_EndFn, testIndex, std::move(result));
+            }
+        };
+    }
+
+    // A TestGenerator over plain callables, for suites whose tests are computed (e.g., from a table or a combination
+    // of inputs) rather than declared one by one. Nothing is built per test up front; a test's name is only formatted
+    // when a filter, reporter, or failure needs it.
+    template <typename NameFnT, typename TestFnT>
+        requires std::invocable<const NameFnT&, std::size_t, std::string&>
+            && std::is_invocable_r_v<Result, const TestFnT&, std::size_t>
+    class LazyTestGenerator final : public TestGenerator
+    {
+    private:
+
+        std::size_t m_TestCount;
+        NameFnT m_NameFn;
+        TestFnT m_TestFn;
+        TestTags m_Tags;
+
+    public:
+
+        LazyTestGenerator(
+            _In_ const std::size_t testCount,
+            _Inout_ NameFnT nameFn,
+            _Inout_ TestFnT testFn,
+            _In_ const TestTags tags) :
+            m_TestCount{testCount},
+            m_NameFn{std::move(nameFn)},
+            m_TestFn{std::move(testFn)},
+            m_Tags{tags}
+        { }
+
+        [[nodiscard]] std::size_t GetTestCount() const override
+        {
+            return m_TestCount;
+        }
+
+        void FormatTestName(
+            _In_ const std::size_t testIndex,
+            _Inout_ std::string& testName) const override
+        {
+            testName.clear();
+            std::invoke(m_NameFn, testIndex, testName);
+        }
+
+        [[nodiscard]] Result RunTest(_In_ const std::size_t testIndex) const override
+        {
+            return std::invoke(m_TestFn, testIndex);
+        }
+
+        [[nodiscard]] TestTags GetTestTags(_In_ const std::size_t) const override
+        {
+            return m_Tags;
+        }
+    };
+
+    // E.g., MakeLazyTests(cases.size(), [](std::size_t i, std::string& name) { std::format_to(std::back_inserter(name), "Case{}", i); }, RunCase)
+    // nameFn appends the test's name to an empty string; testFn runs the test at an index.
+    template <typename NameFnT, typename TestFnT>
+    [[nodiscard]] std::unique_ptr<const TestGenerator> MakeLazyTests(
+        _In_ const std::size_t testCount,
+        _Inout_ NameFnT nameFn,
+        _Inout_ TestFnT testFn,
+        _In_ const TestTags tags = {})
+    {
+        return std::make_unique<const LazyTestGenerator<NameFnT, TestFnT>>(testCount, std::move(nameFn), std::move(testFn), tags);
+    }
 }
 
 namespace SUTL = SimpleUnitTestLibrary;
@@ -0,0 +1,112 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Filter.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Suite.h"
+#include "SimpleUnitTestLibrary.Tags.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // How Runner's --list mode prints the tests it would run.
+    //   Text: "Suite/Test<TAB>[tag][tag]<TAB>file:line" per test.
+    //   Json: one {"suite","test","tags","file","line"} object per line.
+    // Generated tests have no tags or source location, so those fields are empty (line 0).
+    enum class ListFormat : std::uint8_t
+    {
+        None,
+        Text,
+        Json
+    };
+
+    // Writes every test the filter selects, without running (or materializing results for) any of them.
+    // Output is built in a buffer that's flushed in large chunks, so listing hundreds of thousands of tests takes milliseconds.
+    inline void WriteTestList(
+        _Inout_ std::FILE* pFile,
+        _In_ const std::span<const Suite* const> suites,
+        _In_ const TestFilter& testFilter,
+        _In_ const ListFormat listFormat)
+    {
+        static constexpr std::size_t s_cFlushThreshold{256 * 1024};
+
+        // Looked up once, rather than (under the registry's lock) for every tag of every test.
+        std::array<std::string_view, static_cast<std::size_t>(Tag::_End)> tagNameSVs;
+        for (std::size_t i = 0; i < tagNameSVs.size(); ++i)
+        {
+            tagNameSVs[i] = GetTagName(static_cast<Tag>(i));
+        }
+
+        std::string buffer;
+        buffer.reserve(s_cFlushThreshold + 4096);
+        auto out{std::back_inserter(buffer)};
+        for (const Suite* const pSuite : suites)
+        {
+            const std::string_view suiteNameSV{pSuite->GetSuiteName()};
+            pSuite->VisitSelectedTests(testFilter,
+                [&](_In_ const std::string_view testNameSV, _In_ const TestTags testTags, _In_ const std::source_location& srcLoc)
+                {
+                    if (listFormat == ListFormat::Json)
+                    {
+                        buffer += R"({"suite":")";
+                        Internal_::AppendJsonEscaped(buffer, suiteNameSV);
+                        buffer += R"(","test":")";
+                        Internal_::AppendJsonEscaped(buffer, testNameSV);
+                        buffer += R"(","tags":[)";
+                        bool bFirstTag{true};
+                        for (std::size_t i = 0; !testTags.empty() && (i < tagNameSVs.size()); ++i)
+                        {
+                            if (testTags.Contains(static_cast<Tag>(i)))
+                            {
+                                buffer += bFirstTag ? "\"" : ",\"";
+                                Internal_::AppendJsonEscaped(buffer, tagNameSVs[i]);
+                                buffer += '"';
+                                bFirstTag = false;
+                            }
+                        }
+                        buffer += R"(],"file":")";
+                        Internal_::AppendJsonEscaped(buffer, srcLoc.file_name());
+                        std::format_to(out, R"(","line":{}}})" "\n", srcLoc.line());
+                    }
+                    else
+                    {
+                        buffer += suiteNameSV;
+                        buffer += '/';
+                        buffer += testNameSV;
+                        buffer += '\t';
+                        for (std::size_t i = 0; !testTags.empty() && (i < tagNameSVs.size()); ++i)
+                        {
+                            if (testTags.Contains(static_cast<Tag>(i)))
+                            {
+                                std::format_to(out, "[{}]", tagNameSVs[i]);
+                            }
+                        }
+                        std::format_to(out, "\t{}:{}\n", srcLoc.file_name(), srcLoc.line());
+                    }
+
+                    if (buffer.size() >= s_cFlushThreshold)
+                    {
+                        std::fwrite(buffer.data(), 1, buffer.size(), pFile);
+                        buffer.clear();
+                    }
+                });
+        }
+
+        std::fwrite(buffer.data(), 1, buffer.size(), pFile);
+        std::fflush(pFile);
+    }
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
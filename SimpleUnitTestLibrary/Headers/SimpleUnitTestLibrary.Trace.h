@@ -0,0 +1,115 @@
+#pragma once
+
+#if !defined(SUTL_USE_MODULES)
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "APIAnnotations.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Result.h"
+#endif
+
+
+namespace SimpleUnitTestLibrary
+{
+    // Streams a Chrome Trace Event Format timeline (loadable by chrome://tracing, Perfetto UI, speedscope):
+    // a complete ("X") span per suite, suite setup, test, and suite cleanup, on the thread that ran it.
+    class TraceReporter final : public Reporter
+    {
+    private:
+
+        Internal_::BufferedFileWriter m_Writer;
+        std::mutex m_WriterMutex;
+        bool m_bFirstEvent{true};
+        const std::uint64_t m_StartNs{Internal_::GetTimestampNs()};
+
+        // Small, stable per-thread IDs read better in trace viewers than OS thread IDs.
+        [[nodiscard]] static std::uint32_t GetThreadId() noexcept
+        {
+            static constinit std::atomic<std::uint32_t> s_NextThreadId{1};
+            static thread_local const std::uint32_t s_ThreadId{s_NextThreadId.fetch_add(1, std::memory_order_relaxed)};
+            return s_ThreadId;
+        }
+
+        void WriteSpan(
+            _In_ const std::string_view nameSV,
+            _In_ const std::string_view categorySV,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs,
+            _In_ const std::string_view resultSV)
+        {
+            const std::uint64_t tsNs{(beginNs > m_StartNs) ? (beginNs - m_StartNs) : 0};
+            const std::uint64_t durationNs{(endNs > beginNs) ? (endNs - beginNs) : 0};
+            const std::uint32_t threadId{GetThreadId()};
+
+            const std::scoped_lock lock{m_WriterMutex};
+            std::string& buffer{m_Writer.GetBuffer()};
+            buffer += m_bFirstEvent ? "\n{\"name\":\"" : ",\n{\"name\":\"";
+            m_bFirstEvent = false;
+            Internal_::AppendJsonEscaped(buffer, nameSV);
+
+            // Timestamps are in microseconds; print them as fixed-point to keep nanosecond precision without floating point.
+            std::format_to(
+                std::back_inserter(buffer),
+                R"(","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{}.{:03},"dur":{}.{:03},"args":{{"result":"{}"}}}})",
+                categorySV,
+                threadId,
+                tsNs / 1000, tsNs % 1000,
+                durationNs / 1000, durationNs % 1000,
+                resultSV);
+
+            m_Writer.FlushIfFull();
+        }
+
+    public:
+
+        explicit TraceReporter(_In_ const std::filesystem::path& path) :
+            m_Writer{path}
+        {
+            m_Writer.GetBuffer() += R"({"displayTimeUnit":"ms","traceEvents":[)";
+        }
+
+        ~TraceReporter() noexcept override
+        {
+            m_Writer.GetBuffer() += "\n]}\n";
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return !!m_Writer;
+        }
+
+        void OnSuiteBegin(
+            _In_ const std::string_view,
+            _In_ const std::uint64_t) override
+        { }
+
+        void OnTestEnd(
+            _In_ const std::string_view,
+            _In_ const std::string_view testNameSV,
+            _In_ const TestStage testStage,
+            _In_ const Result& result,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            WriteSpan(testNameSV, TestStageToString(testStage), beginNs, endNs, ResultTypeToString(result.m_ResultType));
+        }
+
+        void OnSuiteEnd(
+            _In_ const std::string_view suiteNameSV,
+            _In_ const ResultTypeCounts& resultTypeCounts,
+            _In_ const std::uint64_t beginNs,
+            _In_ const std::uint64_t endNs) override
+        {
+            WriteSpan(suiteNameSV, "suite"sv, beginNs, endNs, (GetFailureCount(resultTypeCounts) == 0) ? "Success"sv : "Failure"sv);
+        }
+    };
+}
+
+namespace SUTL = SimpleUnitTestLibrary;
@@ -1,6 +1,7 @@
 #pragma once
 
 #if !defined(SUTL_USE_MODULES)
+#include <algorithm>
 #include <array>
 #include <string_view>
 
@@ -58,6 +59,49 @@ namespace SimpleUnitTestLibrary
             return function;
         }
 
+        // Splits the next comma-separated field off the front of line (e.g., a LineFileSource parameter).
+        // Quoted fields are returned without their surrounding quotes; doubled quotes inside are left as-is.
+        [[nodiscard]] inline constexpr std::string_view NextCsvField(
+            _Inout_ std::string_view& line) noexcept
+        {
+            std::string_view field;
+            std::size_t fieldEndPos{0};
+            if (line.starts_with('"'))
+            {
+                std::size_t closingQuotePos{line.find('"', 1)};
+                while ((closingQuotePos != std::string_view::npos) &&
+                    (closingQuotePos + 1 < line.size()) &&
+                    (line[closingQuotePos + 1] == '"'))
+                {
+                    closingQuotePos = line.find('"', closingQuotePos + 2);
+                }
+
+                fieldEndPos = (closingQuotePos == std::string_view::npos) ? line.size() : closingQuotePos;
+                field = line.substr(1, fieldEndPos - 1);
+            }
+            else
+            {
+                fieldEndPos = line.find(',');
+                field = line.substr(0, fieldEndPos);
+            }
+
+            const std::size_t separatorPos{line.find(',', std::min(fieldEndPos, line.size()))};
+            line = (separatorPos == std::string_view::npos) ? std::string_view{} : line.substr(separatorPos + 1);
+            return field;
+        }
+
+        [[nodiscard]] inline constexpr char ToLowerAscii(_In_ const char c) noexcept
+        {
+            return ('A' <= c && c <= 'Z') ? static_cast<char>(c | static_cast<char>(0x20)) : c;
+        }
+
+        [[nodiscard]] inline constexpr bool EqualsIgnoreCaseAscii(
+            _In_ const std::string_view lhs,
+            _In_ const std::string_view rhs) noexcept
+        {
+            return std::ranges::equal(lhs, rhs, [](_In_ const char l, _In_ const char r) static constexpr { return ToLowerAscii(l) == ToLowerAscii(r); });
+        }
+
         // Mock examples.
         using namespace std::string_view_literals;
         static_assert(ParseFunctionName(""sv) == ""sv);
@@ -71,6 +115,18 @@ namespace SimpleUnitTestLibrary
         static_assert(ParseFunctionName("struct rettype __vectorcall func(paramtype)"sv) == "func"sv);
         static_assert(ParseFunctionName("class rettype __clrcall func(paramtype)"sv) == "func"sv);
 
+        static_assert([]() constexpr
+        {
+            std::string_view line{"1,two,\"3,4\",\"a\"\"b\",,last"sv};
+            return (NextCsvField(line) == "1"sv)
+                && (NextCsvField(line) == "two"sv)
+                && (NextCsvField(line) == "3,4"sv)
+                && (NextCsvField(line) == "a\"\"b"sv)
+                && (NextCsvField(line) == ""sv)
+                && (NextCsvField(line) == "last"sv)
+                && line.empty();
+        }());
+
         // Real world examples
         static_assert(ParseFunctionName("struct SimpleUnitTestLibrary::UnitTestResult __cdecl Test(void)"sv) == "Test"sv);
         static_assert(ParseFunctionName("struct SimpleUnitTestLibrary::UnitTestResult __cdecl RunTests::<lambda_1>::operator ()(void)"sv) == "RunTests::<lambda_1>::operator ()"sv);
@@ -1,9 +1,31 @@
 #pragma once
 
 #include "SimpleUnitTestLibrary.Logger.h"
+#include "SimpleUnitTestLibrary.AllocationTracking.h"
+#include "SimpleUnitTestLibrary.PerfCounters.h"
 #include "SimpleUnitTestLibrary.Result.h"
 #include "SimpleUnitTestLibrary.Test.h"
+#include "SimpleUnitTestLibrary.Arena.h"
+#include "SimpleUnitTestLibrary.AsyncTest.h"
+#include "SimpleUnitTestLibrary.Reporter.h"
+#include "SimpleUnitTestLibrary.Trace.h"
+#include "SimpleUnitTestLibrary.JUnitReporter.h"
+#include "SimpleUnitTestLibrary.JsonLinesReporter.h"
+#include "SimpleUnitTestLibrary.BinaryResults.h"
 #include "SimpleUnitTestLibrary.Suite.h"
+#include "SimpleUnitTestLibrary.StaticRegistry.h"
+#include "SimpleUnitTestLibrary.CompileTimeSuite.h"
+#include "SimpleUnitTestLibrary.Progress.h"
+#include "SimpleUnitTestLibrary.Shuffle.h"
+#include "SimpleUnitTestLibrary.Filter.h"
+#include "SimpleUnitTestLibrary.Tags.h"
+#include "SimpleUnitTestLibrary.TestList.h"
 #include "SimpleUnitTestLibrary.Runner.h"
 #include "SimpleUnitTestLibrary.Macros.h"
 #include "SimpleUnitTestLibrary.Evaluators.h"
+#include "SimpleUnitTestLibrary.Fuzz.h"
+#include "SimpleUnitTestLibrary.MappedFile.h"
+#include "SimpleUnitTestLibrary.Parameterized.h"
+#include "SimpleUnitTestLibrary.Fixture.h"
+#include "SimpleUnitTestLibrary.Snapshot.h"
+#include "SimpleUnitTestLibrary.DeathTest.h"
@@ -0,0 +1,46 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iterator>
+#include <new>
+#include <string>
+#include <utility>
+#endif
+
+
+export module SimpleUnitTestLibrary.AllocationTracking;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <atomic>;
+export import <cstddef>;
+export import <cstdint>;
+export import <cstdlib>;
+export import <format>;
+export import <iterator>;
+export import <new>;
+export import <string>;
+export import <utility>;
+#endif
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.AllocationTracking.h"
+}
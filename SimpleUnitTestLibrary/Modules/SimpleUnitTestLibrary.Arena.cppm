@@ -0,0 +1,34 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#endif
+
+
+export module SimpleUnitTestLibrary.Arena;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <cstddef>;
+export import <memory>;
+export import <memory_resource>;
+export import <string>;
+export import <string_view>;
+#endif
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Arena.h"
+}
@@ -0,0 +1,70 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.AsyncTest;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <atomic>;
+export import <chrono>;
+export import <condition_variable>;
+export import <coroutine>;
+export import <cstddef>;
+export import <cstdint>;
+export import <deque>;
+export import <exception>;
+export import <format>;
+export import <functional>;
+export import <memory>;
+export import <mutex>;
+export import <optional>;
+export import <source_location>;
+export import <span>;
+export import <stop_token>;
+export import <string>;
+export import <string_view>;
+export import <thread>;
+export import <utility>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.Result;
+export import SimpleUnitTestLibrary.Tags;
+export import SimpleUnitTestLibrary.Test;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.AsyncTest.h"
+}
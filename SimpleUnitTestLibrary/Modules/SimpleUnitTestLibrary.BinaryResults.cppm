@@ -0,0 +1,56 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.BinaryResults;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <array>;
+export import <bit>;
+export import <cstddef>;
+export import <cstdint>;
+export import <cstring>;
+export import <filesystem>;
+export import <functional>;
+export import <mutex>;
+export import <span>;
+export import <string>;
+export import <string_view>;
+export import <type_traits>;
+export import <unordered_map>;
+export import <utility>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.MappedFile;
+export import SimpleUnitTestLibrary.Reporter;
+export import SimpleUnitTestLibrary.Result;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.BinaryResults.h"
+}
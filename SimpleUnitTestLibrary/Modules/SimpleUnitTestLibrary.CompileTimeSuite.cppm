@@ -0,0 +1,34 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#endif
+
+
+export module SimpleUnitTestLibrary.CompileTimeSuite;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <cstddef>;
+export import <cstdint>;
+export import <source_location>;
+export import <string_view>;
+#endif
+
+export import SimpleUnitTestLibrary.Result;
+export import SimpleUnitTestLibrary.StaticRegistry;
+export import SimpleUnitTestLibrary.Test;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.CompileTimeSuite.h"
+}
@@ -0,0 +1,65 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <limits>
+#include <regex>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <thread>
+#endif
+
+
+export module SimpleUnitTestLibrary.DeathTest;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <array>;
+export import <cerrno>;
+export import <chrono>;
+export import <concepts>;
+export import <cstdint>;
+export import <cstdio>;
+export import <cstring>;
+export import <format>;
+export import <functional>;
+export import <limits>;
+export import <regex>;
+export import <source_location>;
+export import <string>;
+export import <string_view>;
+export import <thread>;
+#endif
+
+export import SimpleUnitTestLibrary.Result;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.DeathTest.h"
+}
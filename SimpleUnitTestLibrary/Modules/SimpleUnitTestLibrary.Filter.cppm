@@ -0,0 +1,47 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <regex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.Filter;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <atomic>;
+export import <cstdint>;
+export import <format>;
+export import <optional>;
+export import <regex>;
+export import <span>;
+export import <string>;
+export import <string_view>;
+export import <utility>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.Tags;
+export import SimpleUnitTestLibrary.Utils;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Filter.h"
+}
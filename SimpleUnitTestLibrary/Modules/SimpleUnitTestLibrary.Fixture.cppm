@@ -0,0 +1,68 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <format>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.Fixture;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <atomic>;
+export import <concepts>;
+export import <condition_variable>;
+export import <cstddef>;
+export import <cstdint>;
+export import <deque>;
+export import <exception>;
+export import <format>;
+export import <map>;
+export import <memory>;
+export import <mutex>;
+export import <optional>;
+export import <source_location>;
+export import <span>;
+export import <string>;
+export import <string_view>;
+export import <thread>;
+export import <type_traits>;
+export import <utility>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.Result;
+export import SimpleUnitTestLibrary.Tags;
+export import SimpleUnitTestLibrary.Test;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Fixture.h"
+}
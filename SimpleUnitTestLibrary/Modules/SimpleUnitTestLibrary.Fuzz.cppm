@@ -0,0 +1,64 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.Fuzz;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <array>;
+export import <chrono>;
+export import <cstddef>;
+export import <cstdint>;
+export import <cstring>;
+export import <exception>;
+export import <filesystem>;
+export import <format>;
+export import <fstream>;
+export import <iterator>;
+export import <random>;
+export import <span>;
+export import <string>;
+export import <string_view>;
+export import <system_error>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.Result;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Fuzz.h"
+}
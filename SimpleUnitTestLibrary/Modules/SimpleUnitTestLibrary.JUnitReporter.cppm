@@ -0,0 +1,42 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <string_view>
+#endif
+
+
+export module SimpleUnitTestLibrary.JUnitReporter;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <cstdint>;
+export import <filesystem>;
+export import <format>;
+export import <iterator>;
+export import <mutex>;
+export import <numeric>;
+export import <string>;
+export import <string_view>;
+#endif
+
+export import SimpleUnitTestLibrary.Reporter;
+export import SimpleUnitTestLibrary.Result;
+export import SimpleUnitTestLibrary.Utils;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.JUnitReporter.h"
+}
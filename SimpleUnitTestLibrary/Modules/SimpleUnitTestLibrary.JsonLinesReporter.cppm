@@ -0,0 +1,39 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#endif
+
+
+export module SimpleUnitTestLibrary.JsonLinesReporter;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <cstdint>;
+export import <filesystem>;
+export import <format>;
+export import <iterator>;
+export import <mutex>;
+export import <string>;
+export import <string_view>;
+#endif
+
+export import SimpleUnitTestLibrary.Reporter;
+export import SimpleUnitTestLibrary.Result;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.JsonLinesReporter.h"
+}
@@ -1,21 +1,41 @@
 module;
 
-#include "..\Headers\APIAnnotations.h"
+#include "../Headers/APIAnnotations.h"
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <print>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#endif
+
 
 export module SimpleUnitTestLibrary.Logger;
 
+#if !defined(SUTL_NO_HEADER_UNITS)
 export import <concepts>;
-export import <cstdint>;
+export import <cstddef>;
 export import <format>;
+export import <functional>;
 export import <print>;
 export import <source_location>;
 export import <string>;
 export import <string_view>;
 export import <type_traits>;
+export import <utility>;
+#endif
 
 import SimpleUnitTestLibrary.Utils;
 
 export
 {
-#include "..\Headers\SimpleUnitTestLibrary.Logger.h"
+#include "../Headers/SimpleUnitTestLibrary.Logger.h"
 }
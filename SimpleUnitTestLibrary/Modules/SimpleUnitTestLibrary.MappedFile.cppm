@@ -0,0 +1,47 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#endif
+
+
+export module SimpleUnitTestLibrary.MappedFile;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <cerrno>;
+export import <cstddef>;
+export import <filesystem>;
+export import <span>;
+export import <string_view>;
+export import <system_error>;
+export import <utility>;
+#endif
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.MappedFile.h"
+}
@@ -0,0 +1,49 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.Parameterized;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <concepts>;
+export import <cstddef>;
+export import <cstring>;
+export import <filesystem>;
+export import <format>;
+export import <iterator>;
+export import <memory>;
+export import <string>;
+export import <string_view>;
+export import <type_traits>;
+export import <utility>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.MappedFile;
+export import SimpleUnitTestLibrary.Test;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Parameterized.h"
+}
@@ -0,0 +1,46 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <system_error>
+#endif
+
+
+export module SimpleUnitTestLibrary.PerfCounters;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <array>;
+export import <atomic>;
+export import <cerrno>;
+export import <cstddef>;
+export import <cstdint>;
+export import <format>;
+export import <string>;
+export import <string_view>;
+export import <system_error>;
+#endif
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.PerfCounters.h"
+}
@@ -0,0 +1,50 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#endif
+
+
+export module SimpleUnitTestLibrary.Progress;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <chrono>;
+export import <cmath>;
+export import <condition_variable>;
+export import <cstdint>;
+export import <cstdio>;
+export import <format>;
+export import <mutex>;
+export import <stop_token>;
+export import <string>;
+export import <thread>;
+#endif
+
+export import SimpleUnitTestLibrary.Result;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Progress.h"
+}
@@ -0,0 +1,48 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.Reporter;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <array>;
+export import <atomic>;
+export import <chrono>;
+export import <cstdint>;
+export import <cstdio>;
+export import <filesystem>;
+export import <format>;
+export import <iterator>;
+export import <string>;
+export import <string_view>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.Result;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Reporter.h"
+}
@@ -1,23 +1,54 @@
 module;
 
-#include "..\Headers\APIAnnotations.h"
+#include "../Headers/APIAnnotations.h"
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <utility>
+#endif
+
 
 export module SimpleUnitTestLibrary.Result;
 
+#if !defined(SUTL_NO_HEADER_UNITS)
 export import <algorithm>;
 export import <array>;
-export import <charconv>;
+export import <atomic>;
+export import <condition_variable>;
+export import <cstddef>;
 export import <cstdint>;
 export import <format>;
+export import <iterator>;
+export import <memory>;
+export import <mutex>;
+export import <numeric>;
 export import <source_location>;
 export import <string>;
 export import <string_view>;
-export import <system_error>;
+export import <utility>;
+#endif
 
+export import SimpleUnitTestLibrary.AllocationTracking;
+export import SimpleUnitTestLibrary.PerfCounters;
 import SimpleUnitTestLibrary.Logger;
 import SimpleUnitTestLibrary.Utils;
 
 export
 {
-#include "..\Headers\SimpleUnitTestLibrary.Result.h"
+#include "../Headers/SimpleUnitTestLibrary.Result.h"
 }
@@ -2,18 +2,74 @@ module;
 
 // Legacy Private Includes //
 
-#include "..\Headers\APIAnnotations.h"
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <format>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+#endif
 
 
 export module SimpleUnitTestLibrary.Runner;
 
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <atomic>;
+export import <charconv>;
+export import <cstddef>;
+export import <cstdint>;
+export import <cstdio>;
+export import <deque>;
+export import <filesystem>;
+export import <format>;
+export import <future>;
+export import <iterator>;
+export import <memory>;
+export import <optional>;
 export import <ranges>;
+export import <string>;
 export import <string_view>;
+export import <system_error>;
+export import <utility>;
 export import <vector>;
+#endif
 
+export import SimpleUnitTestLibrary.AsyncTest;
+export import SimpleUnitTestLibrary.BinaryResults;
+export import SimpleUnitTestLibrary.Filter;
+export import SimpleUnitTestLibrary.JsonLinesReporter;
+export import SimpleUnitTestLibrary.JUnitReporter;
+export import SimpleUnitTestLibrary.Logger;
+export import SimpleUnitTestLibrary.Progress;
+export import SimpleUnitTestLibrary.Reporter;
+export import SimpleUnitTestLibrary.Shuffle;
+export import SimpleUnitTestLibrary.Snapshot;
+export import SimpleUnitTestLibrary.StaticRegistry;
 export import SimpleUnitTestLibrary.Suite;
+export import SimpleUnitTestLibrary.TestList;
+export import SimpleUnitTestLibrary.Trace;
 
 export
 {
-#include "..\Headers\SimpleUnitTestLibrary.Runner.h"
+#include "../Headers/SimpleUnitTestLibrary.Runner.h"
 }
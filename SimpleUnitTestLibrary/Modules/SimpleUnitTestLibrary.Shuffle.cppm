@@ -0,0 +1,40 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.Shuffle;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <atomic>;
+export import <cstddef>;
+export import <cstdint>;
+export import <numeric>;
+export import <random>;
+export import <ranges>;
+export import <string_view>;
+export import <utility>;
+export import <vector>;
+#endif
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Shuffle.h"
+}
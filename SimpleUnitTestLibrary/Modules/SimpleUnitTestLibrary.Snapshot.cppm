@@ -0,0 +1,60 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#endif
+
+
+export module SimpleUnitTestLibrary.Snapshot;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
+export import <atomic>;
+export import <cerrno>;
+export import <cstddef>;
+export import <cstdint>;
+export import <cstring>;
+export import <filesystem>;
+export import <format>;
+export import <source_location>;
+export import <span>;
+export import <string>;
+export import <string_view>;
+export import <system_error>;
+#endif
+
+export import SimpleUnitTestLibrary.MappedFile;
+export import SimpleUnitTestLibrary.Result;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Snapshot.h"
+}
@@ -0,0 +1,37 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <source_location>
+#include <span>
+#include <string_view>
+#endif
+
+
+export module SimpleUnitTestLibrary.StaticRegistry;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <concepts>;
+export import <cstddef>;
+export import <functional>;
+export import <source_location>;
+export import <span>;
+export import <string_view>;
+#endif
+
+export import SimpleUnitTestLibrary.Tags;
+export import SimpleUnitTestLibrary.Test;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.StaticRegistry.h"
+}
@@ -2,26 +2,61 @@ module;
 
 // Legacy Private Includes //
 
-#include "..\Headers\APIAnnotations.h"
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
 
 
 export module SimpleUnitTestLibrary.Suite;
 
+#if !defined(SUTL_NO_HEADER_UNITS)
 export import <algorithm>;
+export import <array>;
 export import <concepts>;
 export import <cstdint>;
+export import <exception>;
 export import <format>;
 export import <functional>;
 export import <iterator>;
+export import <memory>;
 export import <numeric>;
 export import <ranges>;
+export import <source_location>;
+export import <string>;
 export import <string_view>;
 export import <type_traits>;
+export import <utility>;
 export import <vector>;
+#endif
 
+export import SimpleUnitTestLibrary.Filter;
 export import SimpleUnitTestLibrary.Test;
+export import SimpleUnitTestLibrary.Reporter;
+export import SimpleUnitTestLibrary.Shuffle;
+export import SimpleUnitTestLibrary.StaticRegistry;
 
 export
 {
-#include "..\Headers\SimpleUnitTestLibrary.Suite.h"
+#include "../Headers/SimpleUnitTestLibrary.Suite.h"
 }
@@ -0,0 +1,38 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <concepts>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#endif
+
+
+export module SimpleUnitTestLibrary.Tags;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <concepts>;
+export import <cstdint>;
+export import <mutex>;
+export import <optional>;
+export import <string>;
+export import <string_view>;
+export import <vector>;
+#endif
+
+export import SimpleUnitTestLibrary.Utils;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.Tags.h"
+}
@@ -1,14 +1,49 @@
 module;
 
-#include "..\Headers\APIAnnotations.h"
+#include "../Headers/APIAnnotations.h"
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#endif
+
 
 export module SimpleUnitTestLibrary.Test;
 
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <concepts>;
+export import <cstddef>;
+export import <cstdint>;
+export import <format>;
+export import <functional>;
+export import <memory>;
+export import <source_location>;
+export import <span>;
+export import <string>;
+export import <string_view>;
 export import <type_traits>;
+export import <utility>;
+#endif
+
+export import SimpleUnitTestLibrary.AllocationTracking;
+export import SimpleUnitTestLibrary.Arena;
 
 export import SimpleUnitTestLibrary.Result;
+export import SimpleUnitTestLibrary.Tags;
 
 export
 {
-#include "..\Headers\SimpleUnitTestLibrary.Test.h"
+#include "../Headers/SimpleUnitTestLibrary.Test.h"
 }
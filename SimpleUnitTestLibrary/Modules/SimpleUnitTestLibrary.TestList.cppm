@@ -0,0 +1,45 @@
+module;
+
+// Legacy Private Includes //
+
+#include "../Headers/APIAnnotations.h"
+
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#endif
+
+
+export module SimpleUnitTestLibrary.TestList;
+
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <array>;
+export import <cstdint>;
+export import <cstdio>;
+export import <format>;
+export import <iterator>;
+export import <source_location>;
+export import <span>;
+export import <string>;
+export import <string_view>;
+#endif
+
+export import SimpleUnitTestLibrary.Filter;
+export import SimpleUnitTestLibrary.Reporter;
+export import SimpleUnitTestLibrary.Suite;
+export import SimpleUnitTestLibrary.Tags;
+
+export
+{
+#include "../Headers/SimpleUnitTestLibrary.TestList.h"
+}
@@ -1,13 +1,25 @@
 module;
 
-#include "..\Headers\APIAnnotations.h"
+#include "../Headers/APIAnnotations.h"
+
+// Standard Includes (SUTL_NO_HEADER_UNITS) //
+
+#if defined(SUTL_NO_HEADER_UNITS)
+#include <algorithm>
+#include <array>
+#include <string_view>
+#endif
+
 
 export module SimpleUnitTestLibrary.Utils;
 
+#if !defined(SUTL_NO_HEADER_UNITS)
+export import <algorithm>;
 export import <array>;
 export import <string_view>;
+#endif
 
 export
 {
-#include "..\Headers\SimpleUnitTestLibrary.Utils.h"
+#include "../Headers/SimpleUnitTestLibrary.Utils.h"
 }
@@ -2,8 +2,30 @@ export module SimpleUnitTestLibrary;
 
 export import SimpleUnitTestLibrary.Result;
 export import SimpleUnitTestLibrary.Test;
+export import SimpleUnitTestLibrary.Arena;
+export import SimpleUnitTestLibrary.AsyncTest;
+export import SimpleUnitTestLibrary.Reporter;
+export import SimpleUnitTestLibrary.Trace;
+export import SimpleUnitTestLibrary.JUnitReporter;
+export import SimpleUnitTestLibrary.JsonLinesReporter;
+export import SimpleUnitTestLibrary.BinaryResults;
 export import SimpleUnitTestLibrary.Suite;
+export import SimpleUnitTestLibrary.StaticRegistry;
+export import SimpleUnitTestLibrary.CompileTimeSuite;
+export import SimpleUnitTestLibrary.Progress;
+export import SimpleUnitTestLibrary.Shuffle;
+export import SimpleUnitTestLibrary.Filter;
+export import SimpleUnitTestLibrary.Tags;
+export import SimpleUnitTestLibrary.TestList;
 export import SimpleUnitTestLibrary.Runner;
 export import SimpleUnitTestLibrary.Logger;
+export import SimpleUnitTestLibrary.AllocationTracking;
+export import SimpleUnitTestLibrary.PerfCounters;
+export import SimpleUnitTestLibrary.Fuzz;
+export import SimpleUnitTestLibrary.MappedFile;
+export import SimpleUnitTestLibrary.Parameterized;
+export import SimpleUnitTestLibrary.Fixture;
+export import SimpleUnitTestLibrary.Snapshot;
+export import SimpleUnitTestLibrary.DeathTest;
 
 export namespace SUTL = SimpleUnitTestLibrary;
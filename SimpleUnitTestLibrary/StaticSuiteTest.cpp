@@ -0,0 +1,57 @@
+#if defined(SUTL_USE_MODULES)
+import SimpleUnitTestLibrary;
+import std;
+
+#include "Headers\SimpleUnitTestLibrary.Macros.h"
+#else
+#include "Headers\SimpleUnitTestLibrary.h"
+
+#include <cstdint>
+#endif
+
+
+
+// Registered from a translation unit of its own, so the linker must gather it into the same section as any other's.
+// Test.cpp's main expects this suite in every unfiltered run (see g_cRegisteredStaticSuiteNameSV there).
+static constexpr SUTL::Result CountTest()
+{
+    std::uint32_t count{0};
+    for (std::uint32_t i = 0; i < 10; ++i)
+    {
+        count += i;
+    }
+
+    SUTL_TEST_ASSERT(count == 45);
+    SUTL_TEST_SUCCESS();
+}
+
+static constexpr SUTL::Result ShiftTest()
+{
+    SUTL_TEST_ASSERT((std::uint32_t{1} << 4) == 16);
+    SUTL_TEST_SUCCESS();
+}
+
+static constexpr SUTL::Result RegisteredStaticSuiteSetup()
+{
+    SUTL_LOG("Begin");
+    SUTL_TEST_SUCCESS();
+}
+
+static constexpr SUTL::Result RegisteredStaticSuiteCleanup()
+{
+    SUTL_LOG("End");
+    SUTL_TEST_SUCCESS();
+}
+
+constexpr SUTL::StaticTestDescriptor g_cRegisteredStaticTestDescriptors[]
+{
+    SUTL_STATIC_UNIT_TEST(CountTest),
+    SUTL_STATIC_UNIT_TEST(ShiftTest, SUTL::Tag::Slow)
+};
+
+SUTL_REGISTER_STATIC_SUITE(
+    g_cRegisteredStaticSuite,
+    "RegisteredStaticSuite",
+    g_cRegisteredStaticTestDescriptors,
+    RegisteredStaticSuiteSetup,
+    RegisteredStaticSuiteCleanup);
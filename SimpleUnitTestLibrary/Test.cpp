@@ -6,12 +6,30 @@ inline constexpr int EXIT_SUCCESS = 0;
 inline constexpr int EXIT_FAILURE = 1;
 
 #include "Headers\SimpleUnitTestLibrary.Macros.h"
+#include "Headers\SimpleUnitTestLibrary.AllocationHooks.h"
+#include "Headers\SimpleUnitTestLibrary.FuzzCoverageHooks.h"
 #else
 #include "Headers\SimpleUnitTestLibrary.h"
+#include "Headers\SimpleUnitTestLibrary.AllocationHooks.h"
+#include "Headers\SimpleUnitTestLibrary.FuzzCoverageHooks.h"
 
 #include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <mutex>
+#include <numeric>
 #include <print>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
 #endif
 
 
@@ -118,6 +136,27 @@ static_assert(
         [](_In_ const SUTL::Suite& suite) static constexpr { return !!suite(); }));
 #endif
 
+// Registered with SUTL_REGISTER_STATIC_SUITE, these would be collected by the linker; here, the descriptors are built into a suite and run at compile time.
+constexpr SUTL::StaticTestDescriptor g_cStaticTestDescriptors[]
+{
+    SUTL_STATIC_UNIT_TEST(MyFreeFunctionTest<false>),
+    SUTL_STATIC_UNIT_TEST(MyVeryLonglyNamedAndAwesomeFreeFunctionTestImplementation<false>, SUTL::Tag::Slow)
+};
+
+#if !defined(SUTL_USE_MODULES)
+static_assert(!!SUTL::Suite{SUTL::StaticSuiteDescriptor{"StaticTestSuite", g_cStaticTestDescriptors}}());
+#endif
+
+// The same descriptors, run by the compiler alone (no Suite is built); a failure would fail the build, naming the failing test.
+#if !defined(SUTL_USE_MODULES)
+SUTL_STATIC_SUITE(g_cCompileTimeTestSuite, "CompileTimeTestSuite", g_cStaticTestDescriptors);
+
+constexpr SUTL::StaticTestDescriptor g_cFailingStaticTestDescriptors[]{SUTL_STATIC_UNIT_TEST(MyFreeFunctionTest<false>), SUTL_STATIC_UNIT_TEST(MyFreeFunctionTest<true>)};
+constexpr SUTL::StaticSuiteReport g_cFailingStaticSuiteReport{SUTL::EvaluateStaticSuite(SUTL::StaticSuiteDescriptor{"FailingStaticTestSuite", g_cFailingStaticTestDescriptors})};
+static_assert(!g_cFailingStaticSuiteReport.m_bPassed && (g_cFailingStaticSuiteReport.m_FailureCount == 1));
+static_assert(g_cFailingStaticSuiteReport.m_FirstFailure.View().starts_with("FailingStaticTestSuite/MyFreeFunctionTest<true>: TestFailure: bFlag ("));
+#endif
+
 std::fstream CreateLogFile(_In_ const std::string_view testName)
 {
     return std::fstream{
@@ -211,59 +250,1423 @@ static_assert(
         [](const SUTL::Suite& suite) static constexpr { return !!suite(); }));
 #endif
 
+struct GoldenAdditionVector
+{
+    std::int32_t m_Lhs;
+    std::int32_t m_Rhs;
+    std::int32_t m_Sum;
+};
 
+static SUTL::Result GoldenAdditionRecordTest(_In_ const GoldenAdditionVector& vector)
+{
+    SUTL_TEST_ASSERT(vector.m_Lhs + vector.m_Rhs == vector.m_Sum);
+    SUTL_TEST_SUCCESS();
+}
 
-int main(
-    const int argc,
-    const char* argv[])
+static void FormatSquareTestName(
+    _In_ const std::size_t testIndex,
+    _Inout_ std::string& testName)
 {
-    const std::string_view suiteFilterSV{argc <= 1 ? std::string_view{} : argv[1]};
+    std::format_to(std::back_inserter(testName), "SquareTest[{}]", testIndex);
+}
+
+static SUTL::Result SquareTest(_In_ const std::size_t testIndex)
+{
+    const std::uint64_t value{testIndex};
+    SUTL_TEST_ASSERT((value * value) / ((value == 0) ? 1 : value) == value);
+    SUTL_TEST_SUCCESS();
+}
+
+// Expensive to build, so pooled: each thread builds one, and reuses it for every test it runs.
+struct PrimeTableFixture
+{
+    std::vector<std::uint32_t> m_Primes;
+    std::vector<std::uint32_t> m_Scratch;
+
+    PrimeTableFixture()
     {
-        std::array runtimeSuccessfulTestSuites{GenerateSuccessfulTestSuites()};
-        const auto runResults{SUTL::Runner{suiteFilterSV}()};
-        if (runResults.empty())
+        std::vector<bool> composite(10'000);
+        for (std::uint32_t i = 2; i < composite.size(); ++i)
         {
-            return EXIT_FAILURE;
+            if (!composite[i])
+            {
+                m_Primes.push_back(i);
+                for (std::size_t j = std::size_t{i} * i; j < composite.size(); j += i)
+                {
+                    composite[j] = true;
+                }
+            }
         }
 
-        for (const auto& suiteResult : runResults)
+        m_Scratch.reserve(m_Primes.size());
+    }
+
+    bool Reset()
+    {
+        m_Scratch.clear();
+        return true;
+    }
+};
+
+static SUTL::Result PrimeCountTest(_Inout_ PrimeTableFixture& fixture)
+{
+    SUTL_TEST_ASSERT(fixture.m_Primes.size() == 1229);
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result TwinPrimeTest(_Inout_ PrimeTableFixture& fixture)
+{
+    SUTL_TEST_ASSERT(fixture.m_Scratch.empty());
+    for (std::size_t i = 1; i < fixture.m_Primes.size(); ++i)
+    {
+        if (fixture.m_Primes[i] - fixture.m_Primes[i - 1] == 2)
         {
-            if (!suiteResult)
-            {
-                return EXIT_FAILURE;
-            }
+            fixture.m_Scratch.push_back(fixture.m_Primes[i]);
+        }
+    }
 
-            std::println("{}", suiteResult);
+    SUTL_TEST_ASSERT(fixture.m_Scratch.size() == 205);
+    SUTL_TEST_SUCCESS();
+}
+
+// Throws something other than a std::exception, which must fail each test's setup rather than escape a worker thread.
+struct ThrowingFixture
+{
+    ThrowingFixture()
+    {
+        throw 42;
+    }
+};
+
+static SUTL::Result ThrowingFixtureTest(_Inout_ ThrowingFixture&)
+{
+    SUTL_TEST_SUCCESS();
+}
+
+// A death test that (untagged) runs alongside another fixture worker's test must fork only once that test is done.
+struct EmptyFixture
+{
+};
+
+static std::atomic<bool> g_bForkGateSlowTestStarted{false};
+static std::atomic<bool> g_bForkGateSlowTestRunning{false};
+
+static SUTL::Result ForkGateSlowTest(_Inout_ EmptyFixture&)
+{
+    g_bForkGateSlowTestRunning = true;
+    g_bForkGateSlowTestStarted = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    g_bForkGateSlowTestRunning = false;
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result ForkGateDeathTest(_Inout_ EmptyFixture&)
+{
+    while (!g_bForkGateSlowTestStarted)
+    {
+        std::this_thread::yield();
+    }
+
+    SUTL_TEST_ASSERT_EXIT(std::exit(g_bForkGateSlowTestRunning ? 1 : 0), SUTL::ExitedWithCode{0}, "");
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::AsyncResult AsyncSquareTest(_In_ const std::uint64_t value)
+{
+    co_await SUTL::SleepFor(std::chrono::milliseconds{1});
+    SUTL_CO_TEST_ASSERT((value * value) / ((value == 0) ? 1 : value) == value);
+    SUTL_CO_TEST_SUCCESS();
+}
+
+static SUTL::AsyncResult AsyncTest()
+{
+    // Awaited coroutines yield their Results, checked like any other value.
+    const SUTL::Result squareResult{co_await AsyncSquareTest(12)};
+    SUTL_CO_TEST_ASSERT(!!squareResult);
+
+    co_await SUTL::ResumeOnEventLoop();
+    SUTL_CO_TEST_SUCCESS();
+}
+
+// Each one suspends while it's counted as in flight, so the most in flight at once shows how many interleaved,
+// whatever the number of threads they ran on.
+static std::atomic<std::uint32_t> g_InFlightAsyncTestCount{0};
+static std::atomic<std::uint32_t> g_MaxInFlightAsyncTestCount{0};
+static std::mutex g_AsyncTestThreadIdsMutex;
+static std::vector<std::thread::id> g_AsyncTestThreadIds;
+
+static SUTL::AsyncResult InterleavedAsyncTest()
+{
+    {
+        const std::lock_guard lock{g_AsyncTestThreadIdsMutex};
+        if (std::ranges::find(g_AsyncTestThreadIds, std::this_thread::get_id()) == g_AsyncTestThreadIds.end())
+        {
+            g_AsyncTestThreadIds.push_back(std::this_thread::get_id());
         }
     }
+
+    const std::uint32_t inFlightCount{++g_InFlightAsyncTestCount};
+    std::uint32_t maxInFlightCount{g_MaxInFlightAsyncTestCount.load()};
+    while ((inFlightCount > maxInFlightCount) && !g_MaxInFlightAsyncTestCount.compare_exchange_weak(maxInFlightCount, inFlightCount))
+    {
+    }
+
+    co_await SUTL::SleepFor(std::chrono::milliseconds{50});
+    --g_InFlightAsyncTestCount;
+    SUTL_CO_TEST_SUCCESS();
+}
+
+static SUTL::AsyncResult FailingAsyncTest()
+{
+    co_await SUTL::SleepFor(std::chrono::milliseconds{1});
+    const std::uint32_t value{2 + 3};
+    SUTL_CO_TEST_ASSERT(value == 4);
+    SUTL_CO_TEST_SUCCESS();
+}
+
+static SUTL::AsyncResult SkippedAsyncTest()
+{
+    co_await SUTL::ResumeOnEventLoop();
+    SUTL_CO_TEST_SKIP("Nothing to wait for");
+}
+
+static SUTL::AsyncResult ThrowingAsyncTest()
+{
+    co_await SUTL::ResumeOnEventLoop();
+    throw std::runtime_error{"Thrown from a coroutine"};
+}
+
+static SUTL::AsyncResult ThrowingUnknownAsyncTest()
+{
+    co_await SUTL::ResumeOnEventLoop();
+    throw 42;
+}
+
+// Suite setups pipelined by Runner (see m_SetupPipelineDepth) may run together, and alongside other suites' tests;
+// a SerialOnly test must run with none of them running.
+static std::atomic<std::uint32_t> g_StartedPipelinedSetupCount{0};
+static std::atomic<std::uint32_t> g_RunningPipelinedSetupCount{0};
+static std::atomic<std::uint32_t> g_MaxRunningPipelinedSetupCount{0};
+
+static SUTL::Result PipelinedSetup()
+{
+    ++g_StartedPipelinedSetupCount;
+    const std::uint32_t runningCount{++g_RunningPipelinedSetupCount};
+    std::uint32_t maxRunningCount{g_MaxRunningPipelinedSetupCount.load()};
+    while ((runningCount > maxRunningCount) && !g_MaxRunningPipelinedSetupCount.compare_exchange_weak(maxRunningCount, runningCount))
+    {
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    --g_RunningPipelinedSetupCount;
+    SUTL_TEST_SUCCESS();
+}
+
+// Set up on a pipeline thread, it fails its suite's setup rather than escaping Runner.
+static SUTL::Result ThrowingPipelinedSetup()
+{
+    throw std::runtime_error{"Thrown from a pipelined setup"};
+}
+
+static SUTL::Result PipelinedTest()
+{
+    SUTL_TEST_SUCCESS();
+}
+
+// Long enough for a setup started alongside it to have begun.
+static SUTL::Result SerialOnlyPipelinedTest()
+{
+    const std::uint32_t startedCount{g_StartedPipelinedSetupCount};
+    SUTL_TEST_ASSERT(g_RunningPipelinedSetupCount == 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    SUTL_TEST_ASSERT((g_RunningPipelinedSetupCount == 0) && (g_StartedPipelinedSetupCount == startedCount));
+    SUTL_TEST_SUCCESS();
+}
+
+// Set when HangingAsyncTest's coroutine frame is destroyed, which, once it's been abandoned, is up to the event loop.
+static std::atomic<bool> g_bHangingAsyncTestDestroyed{false};
+
+static SUTL::AsyncResult HangingAsyncTest()
+{
+    struct DestroyedFlag
     {
-        const auto runResults{SUTL::Runner{suiteFilterSV}()};
-        if (!runResults.empty())
+        ~DestroyedFlag() noexcept
         {
-            return EXIT_FAILURE;
+            g_bHangingAsyncTestDestroyed = true;
+        }
+    };
+
+    const DestroyedFlag destroyedFlag;
+    co_await SUTL::SleepFor(std::chrono::seconds{30});
+    SUTL_CO_TEST_SUCCESS();
+}
+
+static SUTL::Result GoldenAdditionLineTest(_In_ const std::string_view& line)
+{
+    std::string_view fields{line};
+    std::array<std::int32_t, 3> values{};
+    for (auto& value : values)
+    {
+        const std::string_view field{SUTL::Utils::NextCsvField(fields)};
+        const auto [pEnd, errc] {std::from_chars(field.data(), field.data() + field.size(), value)};
+        SUTL_SETUP_ASSERT(errc == std::errc{});
+    }
+
+    SUTL_TEST_ASSERT(values[0] + values[1] == values[2]);
+    SUTL_TEST_SUCCESS();
+}
+
+// Removed before and after the run that includes SnapshotTest.
+static std::filesystem::path GetSnapshotTestDirectory()
+{
+    return std::filesystem::temp_directory_path() / "SUTL_Snapshots";
+}
+
+static SUTL::Result SnapshotTest()
+{
+    const auto goldenPath{GetSnapshotTestDirectory() / "SnapshotTest.golden"};
+
+    std::string generated(64 * 1024, 'x');
+    SUTL_SETUP_ASSERT(!!SUTL::UpdateSnapshot(goldenPath, std::as_bytes(std::span{generated})));
+    SUTL_TEST_ASSERT_SNAPSHOT(goldenPath, generated);
+
+    generated[40'000] = 'y';
+    const SUTL::Result mismatchResult{SUTL::CompareSnapshot(goldenPath, generated)};
+    SUTL_TEST_ASSERT(SUTL::IsUpdatingSnapshots() || (!mismatchResult && mismatchResult.m_Info.contains("offset 40000")));
+
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result LeakyTest()
+{
+    static std::unique_ptr<int[]> s_pLeaked;
+    if (!s_pLeaked)
+    {
+        s_pLeaked.reset(new int[16]);
+    }
+    else
+    {
+        s_pLeaked.reset();
+    }
+
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result AllocationTrackingTest()
+{
+    int sum{0};
+    SUTL_TEST_ASSERT_NO_ALLOCATIONS(for (int i = 0; i < 16; ++i) { sum += i; });
+    SUTL_TEST_ASSERT(sum == 120);
+
+    const SUTL::Result allocatingResult{SUTL::ExpectNoAllocations([]() { std::vector<int> v(32); }, "std::vector<int> v(32)")};
+    SUTL_TEST_ASSERT(!SUTL::IsAllocationTrackingEnabled() || !allocatingResult);
+
+    // First run leaks the array, second run frees it.
+    const SUTL::Test leakyTest{"LeakyTest", LeakyTest};
+    const SUTL::AllocationStats leakStats{leakyTest().GetAllocationStats()};
+    SUTL_TEST_ASSERT(leakStats.HasLeaks() == SUTL::IsAllocationTrackingEnabled());
+    SUTL_TEST_ASSERT(!leakStats.m_bTracked || (leakStats.m_NetLiveBytes == 16 * sizeof(int)));
+
+    const SUTL::Test freeingTest{"LeakyTest", LeakyTest};
+    SUTL_TEST_ASSERT(!freeingTest().GetAllocationStats().HasLeaks());
+
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result PerfCounterTest()
+{
+    constexpr std::uint64_t cIterations{100'000};
+
+    SUTL::PerfCounterStats stats;
+    {
+        const SUTL::PerfCounterScope perfCounterScope;
+        volatile std::uint64_t sum{0};
+        for (std::uint64_t i = 0; i < cIterations; ++i)
+        {
+            sum = sum + i;
         }
+        stats = perfCounterScope.GetStats();
     }
+
+    SUTL_TEST_ASSERT(stats.m_bMeasured == SUTL::ArePerfCountersEnabled());
+    SUTL_TEST_ASSERT(!stats.IsAvailable(SUTL::PerfCounter::Instructions) || (stats.GetPerOp(SUTL::PerfCounter::Instructions, cIterations) >= 1.0));
+    if (stats.m_bMeasured)
     {
-        std::array runtimeFailedTestSuites{GenerateFailedTestSuites()};
-        const auto runResults{SUTL::Runner{suiteFilterSV}()};
-        if (runResults.empty())
+        SUTL_LOG("{}", stats.ToString(cIterations));
+    }
+
+    SUTL_TEST_SUCCESS();
+}
+
+#if !defined(SUTL_USE_MODULES)
+static_assert(SUTL::Internal_::GlobPattern{"Math*"}("MathSuite") && SUTL::Internal_::GlobPattern{"Math*"}("mathsuite"));
+static_assert(!SUTL::Internal_::GlobPattern{"Math*"}("BigMathSuite") && !SUTL::Internal_::GlobPattern{"*Suite"}("MathSuites"));
+static_assert(SUTL::Internal_::GlobPattern{"Add?"}("Add1") && !SUTL::Internal_::GlobPattern{"Add?"}("Add") && !SUTL::Internal_::GlobPattern{"Add?"}("Add12"));
+static_assert(SUTL::Internal_::GlobPattern{"*Ma?h*"}("BigMathSuite") && SUTL::Internal_::GlobPattern{"a*b*c"}("aXbYc") && !SUTL::Internal_::GlobPattern{"a*b*c"}("acb"));
+static_assert(!SUTL::Internal_::GlobPattern{"ab*ba"}("aba") && SUTL::Internal_::GlobPattern{"ab*ba"}("abba"));
+static_assert(SUTL::Internal_::GlobPattern{"*"}("") && SUTL::Internal_::GlobPattern{"**"}.MatchesEverything());
+static_assert(SUTL::Internal_::GlobPattern{""}("") && !SUTL::Internal_::GlobPattern{""}("x") && !SUTL::Internal_::GlobPattern{""}.MatchesEverything());
+#endif
+
+// The tag registry is built on first use and lives for the rest of the process; building it here keeps that out of the test's leak check.
+static SUTL::Result TestFilterTestSetup()
+{
+    SUTL_SETUP_ASSERT(SUTL::FindTag("slow") == SUTL::Tag::Slow);
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result TestFilterTest()
+{
+    const SUTL::TestFilter everythingFilter;
+    SUTL_TEST_ASSERT(everythingFilter.SelectsEverything() && (everythingFilter.SelectSuite("MathSuite") == SUTL::FilterSelection::All));
+
+    // Test globs make a suite per-test; an exclude term without a '/' drops whole suites.
+    const std::array cMathExpressions{std::string_view{"Math*/Add*,-*Slow*"}};
+    const SUTL::TestFilter mathFilter{cMathExpressions};
+    SUTL_TEST_ASSERT(mathFilter.GetErrorMessages().empty());
+    SUTL_TEST_ASSERT(mathFilter.SelectSuite("MathSuite") == SUTL::FilterSelection::PerTest);
+    SUTL_TEST_ASSERT(mathFilter.SelectSuite("MathSlowSuite") == SUTL::FilterSelection::None);
+    SUTL_TEST_ASSERT(mathFilter.SelectSuite("StringSuite") == SUTL::FilterSelection::None);
+    SUTL_TEST_ASSERT(mathFilter.IsTestSelected("MathSuite", "AddInts") && mathFilter.IsTestSelected("mathsuite", "addInts"));
+    SUTL_TEST_ASSERT(!mathFilter.IsTestSelected("MathSuite", "SubInts") && !mathFilter.IsTestSelected("MathSlowSuite", "AddInts"));
+
+    // Without wildcards, a pattern is a substring; with any, it's anchored.
+    const std::array cSubstringExpressions{std::string_view{"math"}};
+    const SUTL::TestFilter substringFilter{cSubstringExpressions};
+    SUTL_TEST_ASSERT(substringFilter.SelectSuite("BigMathSuite") == SUTL::FilterSelection::All);
+    const std::array cAnchoredExpressions{std::string_view{"Math?"}};
+    const SUTL::TestFilter anchoredFilter{cAnchoredExpressions};
+    SUTL_TEST_ASSERT(anchoredFilter.SelectSuite("Maths") == SUTL::FilterSelection::All);
+    SUTL_TEST_ASSERT(anchoredFilter.SelectSuite("BigMaths") == SUTL::FilterSelection::None);
+
+    const std::array cExcludeExpressions{std::string_view{"-Math*"}};
+    const SUTL::TestFilter excludeFilter{cExcludeExpressions};
+    SUTL_TEST_ASSERT(excludeFilter.SelectSuite("MathSuite") == SUTL::FilterSelection::None);
+    SUTL_TEST_ASSERT(excludeFilter.SelectSuite("StringSuite") == SUTL::FilterSelection::All);
+
+    // Tags can only be decided per test.
+    const std::array cTagExpressions{std::string_view{"[slow]"}};
+    const SUTL::TestFilter tagFilter{cTagExpressions};
+    SUTL_TEST_ASSERT(tagFilter.SelectSuite("MathSuite") == SUTL::FilterSelection::PerTest);
+    SUTL_TEST_ASSERT(tagFilter.IsTestSelected("MathSuite", "AddInts", SUTL::TestTags{SUTL::Tag::Slow, SUTL::Tag::Integration}));
+    SUTL_TEST_ASSERT(!tagFilter.IsTestSelected("MathSuite", "AddInts", SUTL::TestTags{SUTL::Tag::Integration}));
+    const std::array cExcludeTagExpressions{std::string_view{"-[slow]"}};
+    const SUTL::TestFilter excludeTagFilter{cExcludeTagExpressions};
+    SUTL_TEST_ASSERT(excludeTagFilter.SelectSuite("MathSuite") == SUTL::FilterSelection::PerTest);
+    SUTL_TEST_ASSERT(!excludeTagFilter.IsTestSelected("MathSuite", "AddInts", SUTL::TestTags{SUTL::Tag::Slow}));
+    SUTL_TEST_ASSERT(excludeTagFilter.IsTestSelected("MathSuite", "AddInts"));
+
+    // A regex runs to the end of its expression, commas and all, and is matched against "Suite/Test".
+    const std::array cRegexExpressions{std::string_view{"re:^Io.*/(Read|Seek){1,2}"}};
+    const SUTL::TestFilter regexFilter{cRegexExpressions};
+    SUTL_TEST_ASSERT(regexFilter.GetErrorMessages().empty());
+    SUTL_TEST_ASSERT(regexFilter.SelectSuite("IoSuite") == SUTL::FilterSelection::PerTest);
+    SUTL_TEST_ASSERT(regexFilter.IsTestSelected("IoSuite", "ReadFile") && !regexFilter.IsTestSelected("IoSuite", "WriteFile"));
+    SUTL_TEST_ASSERT(!regexFilter.IsTestSelected("BigIoSuite", "ReadFile"));
+
+    // Terms that don't compile are reported, and match nothing.
+    const std::array cInvalidExpressions{std::string_view{"re:(unclosed"}, std::string_view{"[no-such-tag]"}};
+    const SUTL::TestFilter invalidFilter{cInvalidExpressions};
+    SUTL_TEST_ASSERT(invalidFilter.GetErrorMessages().size() == 2);
+    SUTL_TEST_ASSERT(invalidFilter.SelectSuite("IoSuite") == SUTL::FilterSelection::None);
+    SUTL_TEST_ASSERT(!invalidFilter.IsTestSelected("IoSuite", "(unclosed"));
+
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result DeathTest()
+{
+    SUTL_TEST_ASSERT_DEATH(
+        { std::fputs("fatal: corrupt header\n", stderr); std::abort(); },
+        "corrupt header");
+    SUTL_TEST_ASSERT_EXIT(std::exit(3), SUTL::ExitedWithCode{3}, "");
+
+    const SUTL::Result survivedResult{SUTL::RunDeathTest([]() { }, SUTL::DiedAbnormally{}, "", "Survive")};
+    SUTL_TEST_ASSERT(!survivedResult && survivedResult.m_Info.contains("returned without dying"));
+
+    const SUTL::Result hungResult{SUTL::RunDeathTest(
+        []() { std::this_thread::sleep_for(std::chrono::hours{1}); }, SUTL::DiedAbnormally{}, "", "Hang", std::chrono::milliseconds{100})};
+    SUTL_TEST_ASSERT(!hungResult && hungResult.m_Info.contains("timed out"));
+
+    SUTL_TEST_SUCCESS();
+}
+
+static SUTL::Result LengthPrefixedRecordFuzzTarget(_In_ const std::span<const std::byte> data)
+{
+    // Toy parser: [u8 length][payload...] records back to back, the last of which may be cut short. Every byte must be
+    // accounted for, but the parser has a planted bug for the fuzzer to find: it takes an empty record to end the input.
+    std::size_t pos{0};
+    bool bTruncated{false};
+    while (pos < data.size())
+    {
+        const std::size_t length{static_cast<std::size_t>(data[pos])};
+        if (length == 0)
         {
-            return EXIT_FAILURE;
+            break;
+        }
+
+        if (pos + 1 + length > data.size())
+        {
+            bTruncated = true;
+            break;
+        }
+        pos += 1 + length;
+    }
+
+    SUTL_TEST_ASSERT(bTruncated || (pos == data.size()));
+    SUTL_TEST_SUCCESS();
+}
+
+[[nodiscard]] static std::string ReadTextFile(_In_ const std::filesystem::path& filePath)
+{
+    std::ifstream file{filePath, std::ios_base::binary};
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+[[nodiscard]] static std::size_t CountOccurrences(
+    _In_ const std::string_view textSV,
+    _In_ const std::string_view patternSV)
+{
+    std::size_t count{0};
+    for (std::size_t pos = textSV.find(patternSV); pos != std::string_view::npos; pos = textSV.find(patternSV, pos + patternSV.size()))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+// Just enough of a JSON parser to check that the reports are well-formed: one value, with nothing but whitespace around it.
+class JsonValidator
+{
+private:
+
+    std::string_view m_TextSV;
+    std::size_t m_Pos{0};
+
+    explicit JsonValidator(_In_ const std::string_view textSV) :
+        m_TextSV{textSV}
+    {}
+
+    void SkipWhitespace() noexcept
+    {
+        while ((m_Pos < m_TextSV.size()) && std::string_view{" \t\r\n"}.contains(m_TextSV[m_Pos]))
+        {
+            ++m_Pos;
+        }
+    }
+
+    [[nodiscard]] bool Consume(_In_ const char c) noexcept
+    {
+        SkipWhitespace();
+        if ((m_Pos == m_TextSV.size()) || (m_TextSV[m_Pos] != c))
+        {
+            return false;
         }
 
-        for (const auto& suiteResult : SUTL::Runner{suiteFilterSV}())
+        ++m_Pos;
+        return true;
+    }
+
+    [[nodiscard]] bool ParseString() noexcept
+    {
+        if (!Consume('"'))
+        {
+            return false;
+        }
+
+        while (m_Pos < m_TextSV.size())
         {
-            if (!!suiteResult)
+            const char c{m_TextSV[m_Pos++]};
+            if (c == '"')
             {
-                return EXIT_FAILURE;
+                return true;
             }
 
-            std::println("{}", suiteResult);
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                return false;
+            }
+
+            if (c == '\\')
+            {
+                if (m_Pos == m_TextSV.size())
+                {
+                    return false;
+                }
+
+                const char escaped{m_TextSV[m_Pos++]};
+                if (escaped == 'u')
+                {
+                    if ((m_Pos + 4 > m_TextSV.size())
+                        || !std::ranges::all_of(m_TextSV.substr(m_Pos, 4), [](const char h) { return std::isxdigit(static_cast<unsigned char>(h)) != 0; }))
+                    {
+                        return false;
+                    }
+                    m_Pos += 4;
+                }
+                else if (!std::string_view{"\"\\/bfnrt"}.contains(escaped))
+                {
+                    return false;
+                }
+            }
         }
+
+        return false;
     }
+
+    [[nodiscard]] bool ParseValue(_In_ const std::size_t depth) noexcept
     {
-        const auto runResults{SUTL::Runner{suiteFilterSV}()};
-        if (!runResults.empty())
+        SkipWhitespace();
+        if ((m_Pos == m_TextSV.size()) || (depth > 64))
+        {
+            return false;
+        }
+
+        const char c{m_TextSV[m_Pos]};
+        if (c == '"')
+        {
+            return ParseString();
+        }
+
+        if ((c == '{') || (c == '['))
+        {
+            const bool bObject{c == '{'};
+            const char close{bObject ? '}' : ']'};
+            ++m_Pos;
+            if (Consume(close))
+            {
+                return true;
+            }
+
+            do
+            {
+                if (bObject && (!ParseString() || !Consume(':')))
+                {
+                    return false;
+                }
+
+                if (!ParseValue(depth + 1))
+                {
+                    return false;
+                }
+            } while (Consume(','));
+
+            return Consume(close);
+        }
+
+        for (const std::string_view literalSV : {"true", "false", "null"})
+        {
+            if (m_TextSV.substr(m_Pos).starts_with(literalSV))
+            {
+                m_Pos += literalSV.size();
+                return true;
+            }
+        }
+
+        // Numbers: sign, digits, fraction, exponent; leading zeros and the like aren't worth rejecting here.
+        const std::size_t begin{m_Pos};
+        while ((m_Pos < m_TextSV.size()) && std::string_view{"+-.0123456789eE"}.contains(m_TextSV[m_Pos]))
+        {
+            ++m_Pos;
+        }
+
+        return (m_Pos != begin) && (std::isdigit(static_cast<unsigned char>(m_TextSV[m_Pos - 1])) != 0);
+    }
+
+public:
+
+    [[nodiscard]] static bool IsValid(_In_ const std::string_view textSV) noexcept
+    {
+        JsonValidator validator{textSV};
+        if (!validator.ParseValue(0))
+        {
+            return false;
+        }
+
+        validator.SkipWhitespace();
+        return validator.m_Pos == textSV.size();
+    }
+};
+
+
+
+int main(
+    const int argc,
+    const char* argv[])
+{
+    // StaticSuiteTest.cpp registers one static suite, which every unfiltered run below runs along with the live suites;
+    // the runs that check a report's exact contents filter it out.
+    constexpr std::string_view cRegisteredStaticSuiteNameSV{"RegisteredStaticSuite"};
+    constexpr std::string_view cExcludeRegisteredStaticSuiteSV{"-RegisteredStaticSuite"};
+    {
+        std::vector<std::string_view> staticSuiteNameSVs;
+        SUTL::ForEachStaticSuite(
+            [&staticSuiteNameSVs](_In_ const SUTL::StaticSuiteDescriptor& staticSuiteDescriptor)
+            {
+                staticSuiteNameSVs.push_back(staticSuiteDescriptor.m_SuiteNameSV);
+            });
+        if ((staticSuiteNameSVs.size() != 1) || (staticSuiteNameSVs[0] != cRegisteredStaticSuiteNameSV))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto IsRegisteredStaticSuite = [cRegisteredStaticSuiteNameSV](_In_ const SUTL::Suite::RunResults& suiteResult)
+    {
+        return suiteResult.m_OriginSuiteNameSV == cRegisteredStaticSuiteNameSV;
+    };
+
+    const SUTL::Runner runner{SUTL::Runner::FromCommandLine(argc, argv)};
+    {
+        std::array runtimeSuccessfulTestSuites{GenerateSuccessfulTestSuites()};
+        const auto runResults{runner()};
+        if ((runResults.size() != runtimeSuccessfulTestSuites.size() + 1) || (std::ranges::count_if(runResults, IsRegisteredStaticSuite) != 1))
+        {
+            return EXIT_FAILURE;
+        }
+
+        // A single filter still selects suites by (case-insensitive) substring.
+        const auto filteredRunResults{SUTL::Runner{"successfultestsuite_1"}()};
+        if ((filteredRunResults.size() != 1) || (filteredRunResults[0].m_OriginSuiteNameSV != "SuccessfulTestSuite_1"))
+        {
+            return EXIT_FAILURE;
+        }
+
+        for (const auto& suiteResult : runResults)
+        {
+            if (!suiteResult)
+            {
+                return EXIT_FAILURE;
+            }
+
+            std::println("{}", suiteResult);
+        }
+    }
+    {
+        // With no live suites left, only the static suite runs; it's rebuilt for each run, its tests included.
+        const auto runResults{runner()};
+        if ((runResults.size() != 1)
+            || !IsRegisteredStaticSuite(runResults[0])
+            || !runResults[0]
+            || (runResults[0].m_ResultTypeCounts[static_cast<std::size_t>(SUTL::ResultType::Success)] != 4))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    {
+        std::array runtimeFailedTestSuites{GenerateFailedTestSuites()};
+        const auto runResults{runner()};
+        if (runResults.size() != runtimeFailedTestSuites.size() + 1)
+        {
+            return EXIT_FAILURE;
+        }
+
+        for (const auto& suiteResult : runner())
+        {
+            if (!!suiteResult != IsRegisteredStaticSuite(suiteResult))
+            {
+                return EXIT_FAILURE;
+            }
+
+            std::println("{}", suiteResult);
+        }
+    }
+    {
+        const auto runResults{runner()};
+        if ((runResults.size() != 1) || !IsRegisteredStaticSuite(runResults[0]))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    {
+        const auto parameterDirectory{std::filesystem::temp_directory_path() / "SUTL_Parameterized"};
+        std::filesystem::create_directories(parameterDirectory);
+
+        const auto recordFilePath{parameterDirectory / "GoldenAddition.bin"};
+        {
+            std::ofstream recordFile{recordFilePath, std::ios_base::binary | std::ios_base::trunc};
+            for (std::int32_t i = 0; i < 1000; ++i)
+            {
+                const GoldenAdditionVector vector{i, -2 * i, -i};
+                recordFile.write(reinterpret_cast<const char*>(&vector), sizeof(vector));
+            }
+        }
+
+        const auto lineFilePath{parameterDirectory / "GoldenAddition.csv"};
+        {
+            std::ofstream lineFile{lineFilePath, std::ios_base::trunc};
+            lineFile << "lhs,rhs,sum\n";
+            for (std::int32_t i = 0; i < 1000; ++i)
+            {
+                lineFile << i << ',' << i << ',' << (2 * i) << '\n';
+            }
+        }
+
+        SUTL::Suite parameterizedTestSuite{"ParameterizedTestSuite", std::array<SUTL::Test, 0>{}};
+        parameterizedTestSuite
+            .AddTestGenerator(SUTL_CREATE_PARAMETERIZED_TEST(
+                GoldenAdditionRecordTest, SUTL::FixedRecordFileSource<GoldenAdditionVector>{recordFilePath}))
+            .AddTestGenerator(SUTL_CREATE_PARAMETERIZED_TEST(
+                GoldenAdditionLineTest, SUTL::LineFileSource(lineFilePath, 1)));
+
+        SUTL::Suite lazyTestSuite{"LazyTestSuite", SUTL::MakeLazyTests(10'000, FormatSquareTestName, SquareTest)};
+        SUTL::Suite asyncTestSuite{"AsyncTestSuite", SUTL::MakeAsyncTests({SUTL_CREATE_ASYNC_TEST(AsyncTest)})};
+        const auto pPrimeTablePool{std::make_shared<SUTL::FixturePool<PrimeTableFixture>>()};
+        SUTL::Suite fixtureTestSuite{"FixtureTestSuite", SUTL::MakeFixtureTests<PrimeTableFixture>(
+            {SUTL_CREATE_FIXTURE_TEST(PrimeCountTest), SUTL_CREATE_FIXTURE_TEST(TwinPrimeTest), SUTL_CREATE_FIXTURE_TEST(TwinPrimeTest)},
+            pPrimeTablePool,
+            2)};
+        SUTL::Suite snapshotTestSuite{"SnapshotTestSuite", std::array{SUTL_CREATE_UNIT_TEST(SnapshotTest)}};
+        std::filesystem::remove_all(GetSnapshotTestDirectory());
+        SUTL::Suite deathTestSuite{"DeathTestSuite", std::array{SUTL_CREATE_DEATH_TEST(DeathTest)}};
+        SUTL::Suite perfCounterTestSuite{"PerfCounterTestSuite", std::array{SUTL_CREATE_UNIT_TEST(PerfCounterTest)}};
+        SUTL::Suite allocationTrackingTestSuite{"AllocationTrackingTestSuite", std::array{SUTL_CREATE_UNIT_TEST(AllocationTrackingTest)}};
+        SUTL::Suite testFilterTestSuite{"TestFilterTestSuite", std::array{SUTL_CREATE_UNIT_TEST(TestFilterTest)}, TestFilterTestSetup};
+
+        const auto runResults{runner()};
+        std::filesystem::remove_all(GetSnapshotTestDirectory());
+
+        std::uint64_t testCount{0};
+        for (const auto& suiteResult : runResults)
+        {
+            if (!suiteResult)
+            {
+                return EXIT_FAILURE;
+            }
+
+            std::println("{}", suiteResult);
+            testCount += std::accumulate(suiteResult.GetResultTypeCounts().cbegin(), suiteResult.GetResultTypeCounts().cend(), std::uint64_t{0});
+        }
+
+        // The live, run-wide counters must agree with the per-suite tallies once the run is over.
+        if ((SUTL::GetRunCounters().GetCompletedCount() != testCount) || (SUTL::GetRunCounters().GetFailureCount() != 0))
+        {
+            return EXIT_FAILURE;
+        }
+
+        // At most one fixture per worker thread.
+        if (pPrimeTablePool->GetConstructedCount() > 2)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    {
+        // A failing generated case is listed under its materialized name, and counted with the passing ones.
+        const auto lineFilePath{std::filesystem::temp_directory_path() / "SUTL_Parameterized" / "BadAddition.csv"};
+        {
+            std::ofstream lineFile{lineFilePath, std::ios_base::trunc};
+            lineFile << "lhs,rhs,sum\n1,1,2\n2,2,5\n3,3,6\n";
+        }
+
+        const SUTL::Suite badParameterizedTestSuite{"BadParameterizedTestSuite", SUTL_CREATE_PARAMETERIZED_TEST(
+            GoldenAdditionLineTest, SUTL::LineFileSource(lineFilePath, 1))};
+        const auto runResults{badParameterizedTestSuite()};
+        const SUTL::ResultTypeCounts& resultTypeCounts{runResults.GetResultTypeCounts()};
+        const auto failedTest{std::ranges::find_if(runResults,
+            [](const SUTL::Test& test) { return test.GetResult().m_ResultType == SUTL::ResultType::TestFailure; })};
+        if (!!runResults
+            || (resultTypeCounts[static_cast<std::size_t>(SUTL::ResultType::Success)] != 2)
+            || (resultTypeCounts[static_cast<std::size_t>(SUTL::ResultType::TestFailure)] != 1)
+            || (SUTL::GetFailureCount(resultTypeCounts) != 1)
+            || (failedTest == runResults.end())
+            || (failedTest->GetTestName() != "GoldenAdditionLineTest[1]"))
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::println("{}", runResults);
+    }
+    {
+        // A parameter file that can't be read is one failed test, named after the file, rather than no tests at all.
+        const auto missingFilePath{std::filesystem::temp_directory_path() / "SUTL_Parameterized" / "Missing.csv"};
+        std::filesystem::remove(missingFilePath);
+
+        const SUTL::Suite missingParameterizedTestSuite{"MissingParameterizedTestSuite", SUTL_CREATE_PARAMETERIZED_TEST(
+            GoldenAdditionLineTest, SUTL::LineFileSource(missingFilePath, 1))};
+        const auto runResults{missingParameterizedTestSuite()};
+        if ((runResults.GetResultTypeCounts()[static_cast<std::size_t>(SUTL::ResultType::SetupFailure)] != 1)
+            || (runResults.begin()->GetTestName() != std::format("GoldenAdditionLineTest[{}]", missingFilePath.string()))
+            || !runResults.begin()->GetResult().m_Info.contains(missingFilePath.string()))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    {
+        // A test moved out of its results keeps its name (too long to be stored inline) once the results, and the arena
+        // their names were in, are gone.
+        std::vector<SUTL::Test> movedTests;
+        {
+            const SUTL::Suite movedFromTestSuite{"MovedFromTestSuite", std::array{SUTL_CREATE_UNIT_TEST(MyVeryLonglyNamedAndAwesomeFreeFunctionTestImplementation<false>)}};
+            auto runResults{movedFromTestSuite()};
+            movedTests.push_back(std::move(runResults.m_UnitTests[0]));
+        }
+
+        if ((movedTests[0].GetTestName() != "MyVeryLonglyNamedAndAwesomeFreeFunctionTestImplementation<false>")
+            || (movedTests[0].GetResult().m_ResultType != SUTL::ResultType::Success))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    {
+        // Async tests interleave on fewer event loop threads than there are tests, and fail, throw, and time out like
+        // any other test; a test abandoned at its timeout is destroyed along with the event loop.
+        constexpr std::uint32_t cAsyncThreadCount{2};
+        constexpr std::uint32_t cInterleavedTestCount{32};
+        std::vector<SUTL::AsyncTest> asyncTests(cInterleavedTestCount, SUTL_CREATE_ASYNC_TEST(InterleavedAsyncTest));
+        asyncTests.push_back(SUTL_CREATE_ASYNC_TEST(FailingAsyncTest));
+        asyncTests.push_back(SUTL_CREATE_ASYNC_TEST(SkippedAsyncTest));
+        asyncTests.push_back(SUTL_CREATE_ASYNC_TEST(ThrowingAsyncTest));
+        asyncTests.push_back(SUTL_CREATE_ASYNC_TEST(ThrowingUnknownAsyncTest));
+        asyncTests.push_back(SUTL::AsyncTest{"HangingAsyncTest", HangingAsyncTest, {}, std::chrono::milliseconds{50}});
+
+        std::vector<SUTL::Suite::RunResults> runResults;
+        {
+            const SUTL::Suite asyncBehaviorTestSuite{"AsyncBehaviorTestSuite", SUTL::MakeAsyncTests(std::move(asyncTests))};
+            runResults = SUTL::Runner{.m_FilterSVs = {"AsyncBehaviorTestSuite"}, .m_AsyncThreadCount = cAsyncThreadCount}();
+        }
+
+        if (runResults.size() != 1)
+        {
+            return EXIT_FAILURE;
+        }
+
+        auto HasResult = [&runResults](
+            _In_ const std::string_view testNameSV,
+            _In_ const SUTL::ResultType resultType,
+            _In_ const std::string_view infoSV)
+        {
+            return std::ranges::any_of(runResults[0],
+                [testNameSV, resultType, infoSV](_In_ const SUTL::Test& test)
+                {
+                    return (test.GetTestName() == testNameSV) && (test.GetResult().m_ResultType == resultType) && (test.GetResult().m_Info == infoSV);
+                });
+        };
+
+        const SUTL::ResultTypeCounts& resultTypeCounts{runResults[0].GetResultTypeCounts()};
+        if ((resultTypeCounts[static_cast<std::size_t>(SUTL::ResultType::Success)] != cInterleavedTestCount)
+            || (resultTypeCounts[static_cast<std::size_t>(SUTL::ResultType::TestFailure)] != 2)
+            || (resultTypeCounts[static_cast<std::size_t>(SUTL::ResultType::UnhandledException)] != 2)
+            || (resultTypeCounts[static_cast<std::size_t>(SUTL::ResultType::Skipped)] != 1)
+            || !HasResult("FailingAsyncTest", SUTL::ResultType::TestFailure, "value == 4")
+            || !HasResult("SkippedAsyncTest", SUTL::ResultType::Skipped, "Nothing to wait for")
+            || !HasResult("ThrowingAsyncTest", SUTL::ResultType::UnhandledException, "Thrown from a coroutine")
+            || !HasResult("ThrowingUnknownAsyncTest", SUTL::ResultType::UnhandledException, "Unknown exception")
+            || !HasResult("HangingAsyncTest", SUTL::ResultType::TestFailure, "Timed out after 50 ms")
+            || (g_MaxInFlightAsyncTestCount <= cAsyncThreadCount)
+            || (g_AsyncTestThreadIds.size() > cAsyncThreadCount)
+            || !g_bHangingAsyncTestDestroyed)
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::println("{}", runResults[0]);
+    }
+    {
+        // With setups pipelined, upcoming suites are set up together, but none are while a suite with SerialOnly tests runs.
+        const std::array pipelinedTestSuites
+        {
+            SUTL::Suite{"PipelinedSuite_0", std::array{SUTL_CREATE_UNIT_TEST(PipelinedTest)}, PipelinedSetup},
+            SUTL::Suite{"PipelinedSuite_1", std::array{SUTL_CREATE_UNIT_TEST(PipelinedTest)}, PipelinedSetup},
+            SUTL::Suite{"PipelinedSuite_2", std::array{SUTL_CREATE_UNIT_TEST(SerialOnlyPipelinedTest, SUTL::Tag::SerialOnly)}, PipelinedSetup},
+            SUTL::Suite{"PipelinedSuite_3", std::array{SUTL_CREATE_UNIT_TEST(PipelinedTest)}, PipelinedSetup},
+            SUTL::Suite{"PipelinedSuite_4", std::array{SUTL_CREATE_UNIT_TEST(PipelinedTest)}, PipelinedSetup},
+            SUTL::Suite{"PipelinedSuite_5", std::array{SUTL_CREATE_UNIT_TEST(PipelinedTest)}, ThrowingPipelinedSetup}
+        };
+
+        // Each setup is reported as taking as long as it did, wherever it ran.
+        const auto jsonLinesFilePath{std::filesystem::temp_directory_path() / "SUTL_Pipelined.jsonl"};
+        const std::string jsonLinesFilePathString{jsonLinesFilePath.string()};
+        const auto runResults{SUTL::Runner{
+            .m_FilterSVs = {"PipelinedSuite_*"},
+            .m_SetupPipelineDepth = 2,
+            .m_JsonLinesFilePathSV = jsonLinesFilePathString}()};
+        if ((runResults.size() != pipelinedTestSuites.size())
+            || !std::ranges::all_of(runResults | std::views::take(5), [](_In_ const SUTL::Suite::RunResults& suiteResult) { return !!suiteResult; })
+            || (g_MaxRunningPipelinedSetupCount < 2)
+            || (g_StartedPipelinedSetupCount != 5))
+        {
+            return EXIT_FAILURE;
+        }
+
+        const SUTL::Suite::RunResults& throwingSetupResults{runResults[5]};
+        if (!!throwingSetupResults
+            || (throwingSetupResults.GetResultTypeCounts()[static_cast<std::size_t>(SUTL::ResultType::UnhandledException)] != 1)
+            || (throwingSetupResults.GetResultTypeCounts()[static_cast<std::size_t>(SUTL::ResultType::NotRun)] != 1)
+            || (throwingSetupResults.begin()->GetResult().m_Info != "Suite setup threw: Thrown from a pipelined setup"))
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::size_t setupCount{0};
+        const std::string jsonLines{ReadTextFile(jsonLinesFilePath)};
+        for (const auto line : std::views::split(std::string_view{jsonLines}, '\n'))
+        {
+            const std::string_view lineSV{line.begin(), line.end()};
+            if (!lineSV.contains(R"("result":"Success","duration_ns":)") || !lineSV.contains(R"("stage":"setup")"))
+            {
+                continue;
+            }
+
+            const std::string_view durationSV{lineSV.substr(lineSV.find(R"("duration_ns":)") + std::string_view{R"("duration_ns":)"}.size())};
+            std::uint64_t durationNs{0};
+            std::from_chars(durationSV.data(), durationSV.data() + durationSV.size(), durationNs);
+            if (durationNs < 20'000'000)
+            {
+                return EXIT_FAILURE;
+            }
+            ++setupCount;
+        }
+
+        if (setupCount != 5)
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::filesystem::remove(jsonLinesFilePath);
+    }
+    {
+        if (!SUTL_CREATE_DEATH_TEST(DeathTest, SUTL::Tag::Slow).GetTags().Contains(SUTL::Tag::SerialOnly))
+        {
+            return EXIT_FAILURE;
+        }
+
+        const SUTL::Suite forkGateTestSuite{"ForkGateTestSuite", SUTL::MakeFixtureTests<EmptyFixture>(
+            {SUTL_CREATE_FIXTURE_TEST(ForkGateSlowTest), SUTL_CREATE_FIXTURE_TEST(ForkGateDeathTest)},
+            nullptr,
+            2)};
+        const auto runResults{forkGateTestSuite()};
+        if (SUTL::GetFailureCount(runResults.GetResultTypeCounts()) != 0)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    {
+        // A fixture that can't be built fails its tests' setup, whether it's built per test or for a pool.
+        for (const auto& pThrowingFixturePool : {std::shared_ptr<SUTL::FixturePool<ThrowingFixture>>{}, std::make_shared<SUTL::FixturePool<ThrowingFixture>>()})
+        {
+            const SUTL::Suite throwingFixtureTestSuite{"ThrowingFixtureTestSuite", SUTL::MakeFixtureTests<ThrowingFixture>(
+                {SUTL_CREATE_FIXTURE_TEST(ThrowingFixtureTest), SUTL_CREATE_FIXTURE_TEST(ThrowingFixtureTest)},
+                pThrowingFixturePool,
+                2)};
+            const auto runResults{throwingFixtureTestSuite()};
+            if ((runResults.GetResultTypeCounts()[static_cast<std::size_t>(SUTL::ResultType::SetupFailure)] != 2)
+                || !std::ranges::all_of(runResults,
+                    [](_In_ const SUTL::Test& test) { return test.GetResult().m_Info == "Fixture construction threw: Unknown exception"; }))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    {
+        SUTL::FuzzOptions fuzzOptions;
+        fuzzOptions.m_MaxIterations = 10'000;
+        fuzzOptions.m_Seed = 0x5A17;
+        fuzzOptions.m_Dictionary = {{std::byte{0x00}}, {std::byte{0xFF}, std::byte{0xFF}}};
+
+        fuzzOptions.m_ArtifactDirectory = std::filesystem::temp_directory_path() / "SUTL_Fuzz";
+        std::filesystem::remove_all(fuzzOptions.m_ArtifactDirectory);
+
+        // The fuzzer must find the planted bug, and save the input that shows it.
+        const auto fuzzTarget{SUTL_CREATE_FUZZ_TARGET(LengthPrefixedRecordFuzzTarget)};
+        const auto& fuzzResult{fuzzTarget(fuzzOptions)};
+        if (!!fuzzResult || (fuzzResult.m_ResultType != SUTL::ResultType::TestFailure))
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::vector<std::filesystem::path> artifactPaths;
+        for (const auto& entry : std::filesystem::directory_iterator{fuzzOptions.m_ArtifactDirectory})
+        {
+            artifactPaths.push_back(entry.path());
+        }
+
+        if ((artifactPaths.size() != 1)
+            || !artifactPaths[0].filename().string().starts_with("failure-")
+            || !fuzzResult.m_Info.contains(artifactPaths[0].string()))
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::println("{}{}", fuzzTarget.GetTargetName(), fuzzResult.ToString(1));
+        std::filesystem::remove_all(fuzzOptions.m_ArtifactDirectory);
+    }
+    {
+        // The trace is one JSON document, with a span per suite, suite setup, test, and suite cleanup.
+        const auto traceFilePath{std::filesystem::temp_directory_path() / "SUTL_Trace.json"};
+        const std::string traceFilePathString{traceFilePath.string()};
+        {
+            const SUTL::Suite tracedTestSuite{GenerateSuccessfulTestSuite<4>()};
+            const SUTL::Runner traceRunner{.m_FilterSVs = {cExcludeRegisteredStaticSuiteSV}, .m_TraceFilePathSV = traceFilePathString};
+            for (const auto& suiteResult : traceRunner())
+            {
+                if (!suiteResult)
+                {
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+
+        const std::string trace{ReadTextFile(traceFilePath)};
+        if (!JsonValidator::IsValid(trace)
+            || (CountOccurrences(trace, R"("ph":"X")") != 7)
+            || (CountOccurrences(trace, R"("name":"SuccessfulTestSuite_4","cat":"suite")") != 1)
+            || (CountOccurrences(trace, R"("cat":"setup")") != 1)
+            || (CountOccurrences(trace, R"("cat":"test")") != 4)
+            || (CountOccurrences(trace, R"("cat":"cleanup")") != 1)
+            || (CountOccurrences(trace, R"("name":"MyInlineLambdaTest","cat":"test")") != 1)
+            || (CountOccurrences(trace, R"("result":"Success")") != 7))
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::filesystem::remove(traceFilePath);
+    }
+    {
+        // Names and info with XML/JSON metacharacters come out escaped, and each <testsuite> start tag gets its suite's totals.
+        const auto junitFilePath{std::filesystem::temp_directory_path() / "SUTL_JUnit.xml"};
+        const auto jsonLinesFilePath{std::filesystem::temp_directory_path() / "SUTL_JsonLines.jsonl"};
+        const std::string junitFilePathString{junitFilePath.string()};
+        const std::string jsonLinesFilePathString{jsonLinesFilePath.string()};
+        {
+            const SUTL::Suite escapingTestSuite{"Escaping<&\"\n>Suite", std::array
+            {
+                SUTL::Test{"Less<Than & \"Quoted\"\nName", []() static { SUTL_TEST_SUCCESS(); }},
+                SUTL::Test{"FailingTest", []() static
+                {
+                    return SUTL::Result{SUTL::ResultType::TestFailure, std::source_location::current(), "a < b && \"c\"\nd"};
+                }}
+            }};
+            const SUTL::Suite totalsTestSuite{"TotalsSuite", std::array
+            {
+                SUTL::Test{"PassingTest", []() static { SUTL_TEST_SUCCESS(); }},
+                SUTL::Test{"SkippedTest", []() static { return SUTL::Result{SUTL::ResultType::Skipped, std::source_location::current(), "Not today"}; }},
+                SUTL::Test{"FailingTest", []() static { return SUTL::Result{SUTL::ResultType::TestFailure, std::source_location::current(), "1 == 2"}; }}
+            }};
+
+            const SUTL::Runner reportRunner
+            {
+                .m_FilterSVs = {cExcludeRegisteredStaticSuiteSV},
+                .m_JUnitFilePathSV = junitFilePathString,
+                .m_JsonLinesFilePathSV = jsonLinesFilePathString
+            };
+            if (reportRunner().size() != 2)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+
+        const std::string junit{ReadTextFile(junitFilePath)};
+        if (!junit.contains(R"(<testsuite name="Escaping&lt;&amp;&quot;&#10;&gt;Suite" tests="0000000002" failures="0000000001" errors="0000000000" skipped="0000000000")")
+            || !junit.contains(R"(<testcase name="Less&lt;Than &amp; &quot;Quoted&quot;&#10;Name" classname="Escaping&lt;&amp;&quot;&#10;&gt;Suite")")
+            || !junit.contains(R"(<failure type="TestFailure" message="a &lt; b &amp;&amp; &quot;c&quot;&#10;d">)")
+            || !junit.contains(R"(<testsuite name="TotalsSuite" tests="0000000003" failures="0000000001" errors="0000000000" skipped="0000000001")")
+            || !junit.contains(R"(<skipped message="Not today"/>)")
+            || junit.contains(R"(tests="0000000000")")
+            || !junit.ends_with("</testsuites>\n"))
+        {
+            return EXIT_FAILURE;
+        }
+
+        // One JSON object per line: a record per test and per suite.
+        const std::string jsonLines{ReadTextFile(jsonLinesFilePath)};
+        std::size_t lineCount{0};
+        for (const auto line : std::views::split(std::string_view{jsonLines}, '\n'))
+        {
+            const std::string_view lineSV{line.begin(), line.end()};
+            if (!lineSV.empty() && !JsonValidator::IsValid(lineSV))
+            {
+                return EXIT_FAILURE;
+            }
+            lineCount += !lineSV.empty();
+        }
+
+        if ((lineCount != 7)
+            || !jsonLines.contains(R"("suite":"Escaping<&\"\u000a>Suite","name":"Less<Than & \"Quoted\"\u000aName","stage":"test","result":"Success")")
+            || !jsonLines.contains(R"("info":"a < b && \"c\"\u000ad")")
+            || !jsonLines.contains(R"({"type":"suite","suite":"TotalsSuite",)")
+            || !jsonLines.contains(R"("Success":1,"Skipped":1,"SetupFailure":0,"TestFailure":1,)"))
+        {
+            return EXIT_FAILURE;
+        }
+
+        std::filesystem::remove(junitFilePath);
+        std::filesystem::remove(jsonLinesFilePath);
+    }
+    {
+        // Binary results read back as they were written, shards merge, runs diff test by test, and other versions are refused.
+        const auto resultsDirectory{std::filesystem::temp_directory_path() / "SUTL_Results"};
+        std::filesystem::create_directories(resultsDirectory);
+        const std::string baseFilePathString{(resultsDirectory / "Base.bin").string()};
+        const std::string newFilePathString{(resultsDirectory / "New.bin").string()};
+        {
+            const SUTL::Suite shardTestSuite{"ShardSuite", std::array
+            {
+                SUTL::Test{"StableTest", []() static { SUTL_TEST_SUCCESS(); }},
+                SUTL::Test{"FlakyTest", []() static { SUTL_TEST_SUCCESS(); }},
+                SUTL::Test{"RemovedTest", []() static { SUTL_TEST_SUCCESS(); }}
+            }};
+            if (SUTL::Runner{.m_FilterSVs = {cExcludeRegisteredStaticSuiteSV}, .m_BinaryResultsFilePathSV = baseFilePathString}().size() != 1)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        {
+            const SUTL::Suite shardTestSuite{"ShardSuite", std::array
+            {
+                SUTL::Test{"StableTest", []() static { SUTL_TEST_SUCCESS(); }},
+                SUTL::Test{"FlakyTest", []() static { return SUTL::Result{SUTL::ResultType::TestFailure, std::source_location::current(), "1 == 2"}; }},
+                SUTL::Test{"AddedTest", []() static { return SUTL::Result{SUTL::ResultType::Skipped, std::source_location::current(), "Not today"}; }}
+            }};
+            if (SUTL::Runner{.m_FilterSVs = {cExcludeRegisteredStaticSuiteSV}, .m_BinaryResultsFilePathSV = newFilePathString}().size() != 1)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+
+        auto GetCount = [](_In_ const SUTL::BinarySuiteRecord& suiteRecord, _In_ const SUTL::ResultType resultType) static
+        {
+            return suiteRecord.m_ResultTypeCounts[static_cast<std::size_t>(resultType)];
+        };
+
+        {
+            const SUTL::BinaryResultsFile baseFile{baseFilePathString};
+            const SUTL::BinaryResultsFile newFile{newFilePathString};
+            if (!baseFile || !newFile
+                || (baseFile.GetSuites().size() != 1) || (baseFile.GetTests().size() != 3)
+                || (baseFile.GetString(baseFile.GetSuites()[0].m_Name) != "ShardSuite")
+                || (GetCount(baseFile.GetSuites()[0], SUTL::ResultType::Success) != 3)
+                || (newFile.GetSuites().size() != 1) || (newFile.GetTests().size() != 3)
+                || (GetCount(newFile.GetSuites()[0], SUTL::ResultType::Success) != 1)
+                || (GetCount(newFile.GetSuites()[0], SUTL::ResultType::TestFailure) != 1)
+                || (GetCount(newFile.GetSuites()[0], SUTL::ResultType::Skipped) != 1))
+            {
+                return EXIT_FAILURE;
+            }
+
+            constexpr std::array cBaseTestNames{"StableTest", "FlakyTest", "RemovedTest"};
+            constexpr std::array cNewTests
+            {
+                std::pair{"StableTest", SUTL::ResultType::Success},
+                std::pair{"FlakyTest", SUTL::ResultType::TestFailure},
+                std::pair{"AddedTest", SUTL::ResultType::Skipped}
+            };
+            for (std::size_t i = 0; i < cNewTests.size(); ++i)
+            {
+                const SUTL::BinaryTestRecord& testRecord{newFile.GetTests()[i]};
+                if ((newFile.GetString(testRecord.m_Name) != cNewTests[i].first)
+                    || (testRecord.m_ResultType != cNewTests[i].second)
+                    || (testRecord.m_Stage != SUTL::TestStage::Test)
+                    || (newFile.GetSuiteName(testRecord) != "ShardSuite")
+                    || (newFile.GetString(testRecord.m_File) != "Test.cpp")
+                    || (baseFile.GetString(baseFile.GetTests()[i].m_Name) != cBaseTestNames[i]))
+                {
+                    return EXIT_FAILURE;
+                }
+            }
+
+            const std::vector<SUTL::BinaryResultDifference> differences{SUTL::DiffBinaryResults(baseFile, newFile)};
+            auto HasDifference = [&differences](_In_ const SUTL::BinaryResultChange change, _In_ const std::string_view testKeySV)
+            {
+                return std::ranges::any_of(differences,
+                    [change, testKeySV](_In_ const SUTL::BinaryResultDifference& difference)
+                    {
+                        return (difference.m_Change == change) && (difference.m_TestKey == testKeySV);
+                    });
+            };
+            if ((differences.size() != 3)
+                || !HasDifference(SUTL::BinaryResultChange::Regressed, "ShardSuite/FlakyTest/test")
+                || !HasDifference(SUTL::BinaryResultChange::Added, "ShardSuite/AddedTest/test")
+                || !HasDifference(SUTL::BinaryResultChange::Removed, "ShardSuite/RemovedTest/test")
+                || (std::ranges::find(differences, std::string_view{"1 == 2"}, &SUTL::BinaryResultDifference::m_NewInfoSV) == differences.end()))
+            {
+                return EXIT_FAILURE;
+            }
+
+            SUTL::BinaryResultsMerger merger;
+            merger.Add(baseFile);
+            merger.Add(newFile);
+            std::string mergedBytes;
+            merger.AppendTo(mergedBytes);
+            std::ofstream{resultsDirectory / "Merged.bin", std::ios_base::binary | std::ios_base::trunc}.write(mergedBytes.data(), static_cast<std::streamsize>(mergedBytes.size()));
+
+            // A file from another version of the library is refused, rather than misread.
+            std::string futureBytes{ReadTextFile(baseFilePathString)};
+            SUTL::BinaryResultsHeader header;
+            std::memcpy(&header, futureBytes.data(), sizeof(header));
+            ++header.m_Version;
+            std::memcpy(futureBytes.data(), &header, sizeof(header));
+            std::ofstream{resultsDirectory / "Future.bin", std::ios_base::binary | std::ios_base::trunc}.write(futureBytes.data(), static_cast<std::streamsize>(futureBytes.size()));
+        }
+        {
+            const SUTL::BinaryResultsFile mergedFile{resultsDirectory / "Merged.bin"};
+            const SUTL::BinaryResultsFile futureFile{resultsDirectory / "Future.bin"};
+            if (!mergedFile
+                || (mergedFile.GetSuites().size() != 1) || (mergedFile.GetTests().size() != 6)
+                || (GetCount(mergedFile.GetSuites()[0], SUTL::ResultType::Success) != 4)
+                || (GetCount(mergedFile.GetSuites()[0], SUTL::ResultType::TestFailure) != 1)
+                || (GetCount(mergedFile.GetSuites()[0], SUTL::ResultType::Skipped) != 1)
+                || !!futureFile
+                || (futureFile.GetErrorMessage() != "unsupported binary results version"))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+
+        std::filesystem::remove_all(resultsDirectory);
+    }
+    {
+        // The same seed gives the same order, and within each suite, setup still runs first and cleanup last.
+        const auto jsonLinesFilePath{std::filesystem::temp_directory_path() / "SUTL_Shuffle.jsonl"};
+        const std::string jsonLinesFilePathString{jsonLinesFilePath.string()};
+        const std::array shuffledTestSuites{GenerateSuccessfulTestSuite<5>(), GenerateSuccessfulTestSuite<6>(), GenerateSuccessfulTestSuite<7>()};
+
+        // Each record's suite, test, and stage, in the order they ran.
+        auto RunInOrder = [&jsonLinesFilePath, &jsonLinesFilePathString](_In_ const std::span<const char* const> args)
+        {
+            SUTL::Runner shuffleRunner{SUTL::Runner::FromCommandLine(static_cast<int>(args.size()), args.data())};
+            shuffleRunner.m_JsonLinesFilePathSV = jsonLinesFilePathString;
+            std::ignore = shuffleRunner();
+
+            std::vector<std::string> order;
+            const std::string jsonLines{ReadTextFile(jsonLinesFilePath)};
+            for (const auto line : std::views::split(std::string_view{jsonLines}, '\n'))
+            {
+                const std::string_view lineSV{line.begin(), line.end()};
+                if (lineSV.starts_with(R"({"type":"test",)"))
+                {
+                    order.emplace_back(lineSV.substr(0, lineSV.find(R"(,"result":)")));
+                }
+            }
+
+            return order;
+        };
+
+        constexpr std::array cUnshuffledArgs{"Test", "-RegisteredStaticSuite"};
+        constexpr std::array cShuffledArgs{"Test", "-RegisteredStaticSuite", "--seed=1234"};
+        const std::vector<std::string> declaredOrder{RunInOrder(cUnshuffledArgs)};
+        const std::vector<std::string> shuffledOrder{RunInOrder(cShuffledArgs)};
+        if ((shuffledOrder.size() != 18) || (shuffledOrder != RunInOrder(cShuffledArgs)) || (shuffledOrder == declaredOrder)
+            || !std::ranges::is_permutation(shuffledOrder, declaredOrder))
+        {
+            return EXIT_FAILURE;
+        }
+
+        // Suites still run one at a time: six records each, setup, then the tests, then cleanup.
+        for (std::size_t i = 0; i < shuffledOrder.size(); i += 6)
+        {
+            const std::string_view suiteSV{std::string_view{shuffledOrder[i]}.substr(0, shuffledOrder[i].find(R"(,"name":)"))};
+            for (std::size_t j = i; j < i + 6; ++j)
+            {
+                const bool bSetup{shuffledOrder[j].ends_with(R"("stage":"setup")")};
+                const bool bCleanup{shuffledOrder[j].ends_with(R"("stage":"cleanup")")};
+                if (!shuffledOrder[j].starts_with(suiteSV) || (bSetup != (j == i)) || (bCleanup != (j == i + 5)))
+                {
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+
+        std::filesystem::remove(jsonLinesFilePath);
+    }
+    {
+        // Arguments FromCommandLine can't use are ignored, each with a message, rather than silently changing the run.
+        constexpr std::array cBadArgs{"Test", "--bogus", "--seed=abc", "--async-threads=2", "--pipeline-setup=-1"};
+        const SUTL::Runner badArgsRunner{SUTL::Runner::FromCommandLine(static_cast<int>(cBadArgs.size()), cBadArgs.data())};
+        if (badArgsRunner.m_bShuffle
+            || (badArgsRunner.m_AsyncThreadCount != 2)
+            || (badArgsRunner.m_SetupPipelineDepth != 0)
+            || (badArgsRunner.m_CommandLineErrorMessages != std::vector<std::string>{
+                R"(Unknown option "--bogus"; ignoring it.)",
+                R"(Invalid value in "--seed=abc" (expected a number); ignoring it.)",
+                R"(Invalid value in "--pipeline-setup=-1" (expected a number); ignoring it.)"}))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    {
+        // --list prints what the filter selects, without running anything; generated tests have no tags or source location.
+        const std::source_location srcLoc{std::source_location::current()};
+        const SUTL::Suite listedTestSuite{"ListedSuite", std::array
+        {
+            SUTL::Test{std::string_view{"PlainTest"}, MyFreeFunctionTest<true>, SUTL::TestTags{}, srcLoc},
+            SUTL::Test{std::string_view{"Slow\"Test\""}, MyFreeFunctionTest<true>, SUTL::TestTags{SUTL::Tag::Slow, SUTL::Tag::RequiresRoot}, srcLoc},
+            SUTL::Test{std::string_view{"IntegrationTest"}, MyFreeFunctionTest<true>, SUTL::TestTags{SUTL::Tag::Integration}, srcLoc}
+        }};
+        const SUTL::Suite listedLazyTestSuite{"ListedLazySuite", SUTL::MakeLazyTests(2, FormatSquareTestName, SquareTest)};
+        const std::array<const SUTL::Suite*, 2> listedSuites{&listedTestSuite, &listedLazyTestSuite};
+        const std::array cListExpressions{std::string_view{"-[integration]"}};
+        const SUTL::TestFilter listFilter{cListExpressions};
+
+        auto WriteToString = [&listedSuites, &listFilter](_In_ const SUTL::ListFormat listFormat)
+        {
+            std::FILE* const pFile{std::tmpfile()};
+            if (pFile == nullptr)
+            {
+                return std::string{};
+            }
+
+            SUTL::WriteTestList(pFile, listedSuites, listFilter, listFormat);
+            std::string text(static_cast<std::size_t>(std::ftell(pFile)), '\0');
+            std::rewind(pFile);
+            text.resize(std::fread(text.data(), 1, text.size(), pFile));
+            std::fclose(pFile);
+            return text;
+        };
+
+        const std::string fileName{srcLoc.file_name()};
+        const std::uint32_t line{srcLoc.line()};
+        const std::string expectedText{std::format(
+            "ListedSuite/PlainTest\t\t{0}:{1}\n"
+            "ListedSuite/Slow\"Test\"\t[slow][requires-root]\t{0}:{1}\n"
+            "ListedLazySuite/SquareTest[0]\t\t:0\n"
+            "ListedLazySuite/SquareTest[1]\t\t:0\n",
+            fileName, line)};
+        const std::string expectedJson{std::format(
+            R"({{"suite":"ListedSuite","test":"PlainTest","tags":[],"file":"{0}","line":{1}}})" "\n"
+            R"({{"suite":"ListedSuite","test":"Slow\"Test\"","tags":["slow","requires-root"],"file":"{0}","line":{1}}})" "\n"
+            R"({{"suite":"ListedLazySuite","test":"SquareTest[0]","tags":[],"file":"","line":0}})" "\n"
+            R"({{"suite":"ListedLazySuite","test":"SquareTest[1]","tags":[],"file":"","line":0}})" "\n",
+            fileName, line)};
+        if ((WriteToString(SUTL::ListFormat::Text) != expectedText) || (WriteToString(SUTL::ListFormat::Json) != expectedJson))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    {
+        if ((SUTL::Internal_::FormatDuration(std::chrono::seconds{59}) != "59s")
+            || (SUTL::Internal_::FormatDuration(std::chrono::seconds{60}) != "1m00s")
+            || (SUTL::Internal_::FormatDuration(std::chrono::seconds{3599}) != "59m59s")
+            || (SUTL::Internal_::FormatDuration(std::chrono::seconds{3600}) != "1h00m00s"))
+        {
+            return EXIT_FAILURE;
+        }
+
+        // Off a terminal, a display that's gone before its first refresh prints just the final tally, on a line of its own.
+        std::FILE* const pFile{std::tmpfile()};
+        if (pFile == nullptr)
+        {
+            return EXIT_FAILURE;
+        }
+
+        SUTL::Internal_::g_RunCounters.Reset();
+        SUTL::Internal_::g_RunCounters.Record(SUTL::ResultType::Success, 2);
+        SUTL::Internal_::g_RunCounters.Record(SUTL::ResultType::TestFailure);
+        {
+            const SUTL::ProgressDisplay progressDisplay{4, false, pFile};
+        }
+        SUTL::Internal_::g_RunCounters.Reset();
+
+        std::string text(static_cast<std::size_t>(std::ftell(pFile)), '\0');
+        std::rewind(pFile);
+        text.resize(std::fread(text.data(), 1, text.size(), pFile));
+        std::fclose(pFile);
+        if (!text.starts_with("[3/4  75.0%] 1 failed | ")
+            || !text.ends_with(" tests/s | 0s elapsed\n")
+            || (std::ranges::count(text, '\n') != 1)
+            || text.contains("ETA"))
         {
             return EXIT_FAILURE;
         }
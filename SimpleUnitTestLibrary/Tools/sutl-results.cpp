@@ -0,0 +1,230 @@
+// sutl-results: summarizes, merges, and diffs binary result files (written with Runner's --results=<file>).
+//
+//   sutl-results summary <file>...          Per-suite totals, then every test that failed.
+//   sutl-results merge <out> <file>...      Combines shards into one file; same-named suites are combined.
+//   sutl-results diff <base> <new>          Tests whose result changed, appeared, or disappeared.
+//
+// Tests are matched across files by suite name, test name, and stage.
+//
+// Exit code: 0 on success, 1 when summary finds failures or diff finds regressions, 2 on usage/file errors.
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SimpleUnitTestLibrary.BinaryResults.h"
+
+
+namespace
+{
+    using namespace std::string_view_literals;
+
+    constexpr int g_cExitSuccess{0};
+    constexpr int g_cExitFailures{1};
+    constexpr int g_cExitError{2};
+
+    [[nodiscard]] double ToMilliseconds(_In_ const std::uint64_t durationNs) noexcept
+    {
+        return static_cast<double>(durationNs) / 1e6;
+    }
+
+    [[nodiscard]] std::vector<SUTL::BinaryResultsFile> OpenAll(_In_ const std::span<const char* const> paths)
+    {
+        std::vector<SUTL::BinaryResultsFile> files;
+        files.reserve(paths.size());
+        for (const char* const pPath : paths)
+        {
+            files.emplace_back(std::filesystem::path{pPath});
+            if (!files.back())
+            {
+                std::println(stderr, "{}: {}", pPath, files.back().GetErrorMessage());
+                files.clear();
+                break;
+            }
+        }
+
+        return files;
+    }
+
+    [[nodiscard]] int Summary(_In_ const std::span<const char* const> paths)
+    {
+        const std::vector<SUTL::BinaryResultsFile> files{OpenAll(paths)};
+        if (files.empty())
+        {
+            return g_cExitError;
+        }
+
+        SUTL::ResultTypeCounts totalCounts{};
+        std::uint64_t totalDurationNs{0};
+        for (const SUTL::BinaryResultsFile& file : files)
+        {
+            for (const SUTL::BinarySuiteRecord& suiteRecord : file.GetSuites())
+            {
+                std::uint64_t testCount{0};
+                for (std::size_t i = 0; i < suiteRecord.m_ResultTypeCounts.size(); ++i)
+                {
+                    testCount += suiteRecord.m_ResultTypeCounts[i];
+                    totalCounts[i] += suiteRecord.m_ResultTypeCounts[i];
+                }
+                totalDurationNs += suiteRecord.m_DurationNs;
+
+                std::println("{:<48} {:>8} tests {:>6} failed {:>12.3f} ms",
+                    file.GetString(suiteRecord.m_Name), testCount, SUTL::GetFailureCount(suiteRecord.m_ResultTypeCounts), ToMilliseconds(suiteRecord.m_DurationNs));
+            }
+        }
+
+        std::println("\nTotal ({} file(s), {:.3f} ms):", files.size(), ToMilliseconds(totalDurationNs));
+        for (std::size_t i = 0; i < totalCounts.size(); ++i)
+        {
+            std::println("  {:<20}{}", std::format("{}:", SUTL::ResultTypeToString(static_cast<SUTL::ResultType>(i))), totalCounts[i]);
+        }
+
+        const std::uint64_t failureCount{SUTL::GetFailureCount(totalCounts)};
+        if (failureCount != 0)
+        {
+            std::println("\nFailures:");
+            for (const SUTL::BinaryResultsFile& file : files)
+            {
+                for (const SUTL::BinaryTestRecord& testRecord : file.GetTests())
+                {
+                    if (SUTL::IsFailureResultType(testRecord.m_ResultType))
+                    {
+                        std::println("  {} [{}] ({} @ {}) {}",
+                            SUTL::MakeBinaryTestKey(file, testRecord), SUTL::ResultTypeToString(testRecord.m_ResultType),
+                            file.GetString(testRecord.m_File), testRecord.m_Line, file.GetString(testRecord.m_Info));
+                    }
+                }
+            }
+        }
+
+        return (failureCount == 0) ? g_cExitSuccess : g_cExitFailures;
+    }
+
+    [[nodiscard]] int Merge(
+        _In_z_ const char* const pOutputPath,
+        _In_ const std::span<const char* const> paths)
+    {
+        const std::vector<SUTL::BinaryResultsFile> files{OpenAll(paths)};
+        if (files.empty())
+        {
+            return g_cExitError;
+        }
+
+        SUTL::BinaryResultsMerger merger;
+        for (const SUTL::BinaryResultsFile& file : files)
+        {
+            merger.Add(file);
+        }
+
+        {
+            SUTL::Internal_::BufferedFileWriter fileWriter{std::filesystem::path{pOutputPath}};
+            if (!fileWriter)
+            {
+                std::println(stderr, "{}: unable to create file", pOutputPath);
+                return g_cExitError;
+            }
+
+            merger.AppendTo(fileWriter.GetBuffer());
+        }
+
+        std::println("Merged {} file(s) into {}: {} suite(s), {} test record(s).", files.size(), pOutputPath, merger.GetSuiteCount(), merger.GetTestCount());
+        return g_cExitSuccess;
+    }
+
+    [[nodiscard]] int Diff(
+        _In_z_ const char* const pBasePath,
+        _In_z_ const char* const pNewPath)
+    {
+        const std::array cPaths{pBasePath, pNewPath};
+        const std::vector<SUTL::BinaryResultsFile> files{OpenAll(cPaths)};
+        if (files.empty())
+        {
+            return g_cExitError;
+        }
+
+        const SUTL::BinaryResultsFile& baseFile{files[0]};
+        const SUTL::BinaryResultsFile& newFile{files[1]};
+
+        std::uint64_t regressedCount{0};
+        std::uint64_t fixedCount{0};
+        std::uint64_t changedCount{0};
+        std::uint64_t addedCount{0};
+        std::uint64_t removedCount{0};
+        for (const SUTL::BinaryResultDifference& difference : SUTL::DiffBinaryResults(baseFile, newFile))
+        {
+            const std::string_view newResultSV{SUTL::ResultTypeToString(difference.m_NewResultType)};
+            const std::string_view baseResultSV{SUTL::ResultTypeToString(difference.m_BaseResultType)};
+            switch (difference.m_Change)
+            {
+            case SUTL::BinaryResultChange::Added:
+                ++addedCount;
+
+                // A new test that fails is as much a regression as an existing one that starts failing.
+                regressedCount += SUTL::IsFailureResultType(difference.m_NewResultType) ? 1 : 0;
+                std::println("  ADDED      {} [{}]", difference.m_TestKey, newResultSV);
+                break;
+
+            case SUTL::BinaryResultChange::Removed:
+                ++removedCount;
+                std::println("  REMOVED    {} [{}]", difference.m_TestKey, baseResultSV);
+                break;
+
+            case SUTL::BinaryResultChange::Regressed:
+                ++regressedCount;
+                std::println("  REGRESSED  {} [{} -> {}] {}", difference.m_TestKey, baseResultSV, newResultSV, difference.m_NewInfoSV);
+                break;
+
+            case SUTL::BinaryResultChange::Fixed:
+                ++fixedCount;
+                std::println("  FIXED      {} [{} -> {}] {}", difference.m_TestKey, baseResultSV, newResultSV, difference.m_NewInfoSV);
+                break;
+
+            case SUTL::BinaryResultChange::Changed:
+                ++changedCount;
+                std::println("  CHANGED    {} [{} -> {}] {}", difference.m_TestKey, baseResultSV, newResultSV, difference.m_NewInfoSV);
+                break;
+            }
+        }
+
+        std::println("\n{} regressed (including new failing tests), {} fixed, {} changed, {} added, {} removed.", regressedCount, fixedCount, changedCount, addedCount, removedCount);
+        return (regressedCount == 0) ? g_cExitSuccess : g_cExitFailures;
+    }
+
+    void PrintUsage()
+    {
+        std::println(stderr, "Usage:\n"
+            "  sutl-results summary <file>...\n"
+            "  sutl-results merge <out> <file>...\n"
+            "  sutl-results diff <base> <new>");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const std::span<const char* const> args{argv, static_cast<std::size_t>(argc)};
+    const std::string_view commandSV{(args.size() > 1) ? args[1] : ""};
+
+    if ((commandSV == "summary"sv) && (args.size() >= 3))
+    {
+        return Summary(args.subspan(2));
+    }
+
+    if ((commandSV == "merge"sv) && (args.size() >= 4))
+    {
+        return Merge(args[2], args.subspan(3));
+    }
+
+    if ((commandSV == "diff"sv) && (args.size() == 4))
+    {
+        return Diff(args[2], args[3]);
+    }
+
+    PrintUsage();
+    return g_cExitError;
+}
@@ -0,0 +1,39 @@
+# sutl_add_static_suites(<name> <source>... [AS_TEST])
+#
+# Compiles sources of SUTL_STATIC_SUITEs (see SimpleUnitTestLibrary.Macros.h) into an object library <name>, so their
+# tests are run by the compiler: a failing test fails the compile, with a diagnostic naming the suite, the test, the
+# failed assertion, and its location. Nothing is linked, and nothing is left for the runtime test run.
+#
+# By default the suites are part of the build (ALL), so a failure stops it. With AS_TEST, they're excluded from ALL and
+# built by a CTest test of the same name instead, so a failure is reported (with its diagnostic) alongside the runtime
+# tests rather than breaking the build.
+function(sutl_add_static_suites name)
+    cmake_parse_arguments(PARSE_ARGV 1 SUTL_STATIC_SUITES "AS_TEST" "" "")
+    if(NOT SUTL_STATIC_SUITES_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "sutl_add_static_suites(${name}): no sources given")
+    endif()
+
+    add_library(${name} OBJECT ${SUTL_STATIC_SUITES_UNPARSED_ARGUMENTS})
+    target_link_libraries(${name} PRIVATE SUTL)
+    set_target_properties(${name} PROPERTIES
+        CXX_STANDARD 23
+        CXX_STANDARD_REQUIRED ON
+        CXX_EXTENSIONS OFF
+    )
+
+    # Whole suites are evaluated at once, which can take more steps than compilers allow a constant expression by default.
+    if(MSVC)
+        target_compile_options(${name} PRIVATE /constexpr:steps16777216)
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        target_compile_options(${name} PRIVATE -fconstexpr-steps=16777216)
+    elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        target_compile_options(${name} PRIVATE -fconstexpr-ops-limit=1073741824)
+    endif()
+
+    if(SUTL_STATIC_SUITES_AS_TEST)
+        set_target_properties(${name} PROPERTIES EXCLUDE_FROM_ALL ON)
+        add_test(NAME ${name}
+            COMMAND ${CMAKE_COMMAND} --build ${CMAKE_BINARY_DIR} --target ${name} --config $<CONFIG>
+        )
+    endif()
+endfunction()